@@ -21,4 +21,8 @@
 
 cd "$(dirname "$0")"
 export LD_LIBRARY_PATH=/usr/lib:/lib:/home/root
+# Suppressions of sanitizer builds, copied next to the binary by make SANITIZE=...
+[ -f tsan.supp ] && export TSAN_OPTIONS="suppressions=tsan.supp ${TSAN_OPTIONS}"
+[ -f lsan.supp ] && export LSAN_OPTIONS="suppressions=lsan.supp ${LSAN_OPTIONS}"
+[ -f ubsan.supp ] && export UBSAN_OPTIONS="suppressions=ubsan.supp print_stacktrace=1 ${UBSAN_OPTIONS}"
 ./platform_hal_test $@
@@ -0,0 +1,50 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+* @file fuzz_GetInterfaceStats.c
+* @brief Fuzz target of platform_hal_GetInterfaceStats(), see hal_fuzz.h.
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include "platform_hal.h"
+#include "hal_fuzz.h"
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+    char *ifname = hal_fuzz_string(data, size);
+    INTF_STATS *stats = malloc(sizeof(INTF_STATS));
+
+    if (ifname != NULL && stats != NULL)
+    {
+        platform_hal_GetInterfaceStats(ifname, stats);
+    }
+    free(stats);
+    free(ifname);
+    return 0;
+}
+
+void hal_fuzz_case(const uint8_t *data, size_t size)
+{
+    hal_fuzz_case_begin("GetInterfaceStats", data, size);
+    printf(", HAL_GEN_STRING(");
+    hal_fuzz_case_literal(data, strnlen((const char *)data, size));
+    printf("), HAL_GEN_BUFFER(sizeof(INTF_STATS))");
+    hal_fuzz_case_end();
+}
@@ -0,0 +1,29 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+* @file fuzz_SetSNMPOnboardRebootEnable.c
+* @brief Fuzz target of platform_hal_SetSNMPOnboardRebootEnable(), see hal_fuzz.h.
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include "platform_hal.h"
+#include "hal_fuzz.h"
+
+HAL_FUZZ_STRING_TARGET(SetSNMPOnboardRebootEnable)
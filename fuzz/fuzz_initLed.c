@@ -0,0 +1,70 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+* @file fuzz_initLed.c
+* @brief Fuzz target of platform_hal_initLed(), see hal_fuzz.h.
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include <unistd.h>
+#include "platform_hal.h"
+#include "hal_fuzz.h"
+
+/*
+* The input is the contents of the LED configuration file, where the parsing happens. One
+* file is rewritten for every input rather than created, to keep the rate up.
+*/
+static char gPath[] = "/tmp/hal_fuzz_initLed_XXXXXX";
+static int gFd = -1;
+
+static void remove_file(void)
+{
+    unlink(gPath);
+}
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+    if (gFd < 0)
+    {
+        gFd = mkstemp(gPath);
+        if (gFd < 0)
+        {
+            perror("fuzz_initLed: mkstemp");
+            abort();
+        }
+        atexit(remove_file);
+    }
+    if (ftruncate(gFd, 0) != 0 || pwrite(gFd, data, size, 0) != (ssize_t)size)
+    {
+        perror("fuzz_initLed: write");
+        abort();
+    }
+    platform_hal_initLed(gPath);
+    return 0;
+}
+
+void hal_fuzz_case(const uint8_t *data, size_t size)
+{
+    hal_fuzz_case_begin("initLed", data, size);
+    printf(", HAL_GEN_FILE(");
+    hal_fuzz_case_literal(data, size);
+    printf(")");
+    hal_fuzz_case_end();
+}
@@ -0,0 +1,54 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+* @file fuzz_qos_apply.c
+* @brief Fuzz target of platform_hal_qos_apply(), see hal_fuzz.h.
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include "platform_hal.h"
+#include "hal_fuzz.h"
+
+/* The input is the raw structure, zero filled when shorter and cut when longer */
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+    hal_network_params_t *params = calloc(1, sizeof(*params));
+
+    if (params != NULL)
+    {
+        memcpy(params, data, (size < sizeof(*params)) ? size : sizeof(*params));
+        platform_hal_qos_apply(params);
+        free(params);
+    }
+    return 0;
+}
+
+void hal_fuzz_case(const uint8_t *data, size_t size)
+{
+    if (size > sizeof(hal_network_params_t))
+    {
+        size = sizeof(hal_network_params_t);
+    }
+    hal_fuzz_case_begin("qos_apply", data, size);
+    printf(", HAL_GEN_BYTES(hal_network_params_t, ");
+    hal_fuzz_case_literal(data, size);
+    printf(")");
+    hal_fuzz_case_end();
+}
@@ -0,0 +1,64 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+* @file fuzz_setDscp.c
+* @brief Fuzz target of platform_hal_setDscp(), see hal_fuzz.h.
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include "platform_hal.h"
+#include "hal_fuzz.h"
+
+/*
+* The first byte picks the interface and the command, each among two valid values and two
+* invalid ones, so the DSCP list parser is reached by most inputs. The rest is the list.
+*/
+#define INTERFACE(b) ((WAN_INTERFACE)(DOCSIS + ((b) & 0x03)))
+#define COMMAND(b)   ((TRAFFIC_CNT_COMMAND)(TRAFFIC_CNT_START + (((b) >> 2) & 0x03)))
+
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size)
+{
+    char *values;
+
+    if (size == 0)
+    {
+        return 0;
+    }
+    values = hal_fuzz_string(data + 1, size - 1);
+    if (values != NULL)
+    {
+        platform_hal_setDscp(INTERFACE(data[0]), COMMAND(data[0]), values);
+        free(values);
+    }
+    return 0;
+}
+
+void hal_fuzz_case(const uint8_t *data, size_t size)
+{
+    if (size == 0)
+    {
+        return;
+    }
+    hal_fuzz_case_begin("setDscp", data, size);
+    printf(", HAL_GEN_VALUE(%d), HAL_GEN_VALUE(%d), HAL_GEN_STRING(", (int)INTERFACE(data[0]), (int)COMMAND(data[0]));
+    hal_fuzz_case_literal(data + 1, strnlen((const char *)data + 1, size - 1));
+    printf(")");
+    hal_fuzz_case_end();
+}
@@ -0,0 +1,81 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+* @file hal_fuzz.c
+* @brief Input conversion and row printing shared by the fuzz targets, see hal_fuzz.h.
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include "hal_fuzz.h"
+
+char *hal_fuzz_string(const uint8_t *data, size_t size)
+{
+    char *value = malloc(size + 1);
+
+    if (value != NULL)
+    {
+        memcpy(value, data, size);
+        value[size] = '\0';
+    }
+    return value;
+}
+
+void hal_fuzz_case_begin(const char *api, const uint8_t *data, size_t size)
+{
+    uint32_t hash = 2166136261u;
+    size_t i;
+
+    /* FNV-1a of the input keeps the names of different reproducers apart */
+    for (i = 0; i < size; i++)
+    {
+        hash = (hash ^ data[i]) * 16777619u;
+    }
+    printf("HAL_CASE(fuzz_%08x_%s, %s, RETURN_ERR, HAL_CHECK_NONE", (unsigned)hash, api, api);
+}
+
+void hal_fuzz_case_literal(const uint8_t *data, size_t size)
+{
+    size_t i;
+
+    putchar('"');
+    for (i = 0; i < size; i++)
+    {
+        if (data[i] == '"' || data[i] == '\\' || data[i] == '?')
+        {
+            /* ? too, as "??" would start a trigraph in strict ISO modes */
+            printf("\\%c", data[i]);
+        }
+        else if (data[i] >= 0x20 && data[i] < 0x7F)
+        {
+            putchar(data[i]);
+        }
+        else
+        {
+            /* Always three digits, so a following digit is not taken into the escape */
+            printf("\\%03o", data[i]);
+        }
+    }
+    putchar('"');
+}
+
+void hal_fuzz_case_end(void)
+{
+    printf(")\n");
+}
@@ -0,0 +1,99 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+* @file hal_fuzz.h
+* @brief Helpers shared by the fuzz targets of the APIs that take caller controlled data.
+*
+* Each fuzz_<api>.c defines the libFuzzer entry point LLVMFuzzerTestOneInput(), which feeds
+* one input to one API and returns, so the fuzzer runs it in process, millions of times,
+* against the skeleton or a HAL built from source. It also defines hal_fuzz_case(), which
+* prints an input as a row of src/test_l1_cases.def, so a minimized crash reproducer
+* becomes a permanent L1 case. The rows expect RETURN_ERR, as reproducers are malformed
+* inputs almost always; a row replaying a valid input has to be changed to RETURN_OK.
+*
+* "make fuzz" builds the targets with clang and libFuzzer. "make fuzz-replay" builds them
+* with the default compiler and hal_fuzz_main.c instead, to run reproducers or print their
+* rows without libFuzzer.
+*/
+
+#ifndef __HAL_FUZZ_H__
+#define __HAL_FUZZ_H__
+
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+
+/**
+* @brief Feed one input to the API of the target, the libFuzzer entry point.
+*
+* @return 0, as libFuzzer requires
+*/
+int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size);
+
+/**
+* @brief Print one input as a row of src/test_l1_cases.def on stdout.
+*/
+void hal_fuzz_case(const uint8_t *data, size_t size);
+
+/**
+* @brief Copy an input to a NUL terminated string of the exact size, so reads past it are caught.
+*
+* @return The string, to be freed by the caller, NULL when out of memory
+*/
+char *hal_fuzz_string(const uint8_t *data, size_t size);
+
+/**
+* @brief Start a row for an input: name, API, expected result and check.
+*/
+void hal_fuzz_case_begin(const char *api, const uint8_t *data, size_t size);
+
+/**
+* @brief Print bytes as a C string literal, escaping anything that is not printable.
+*/
+void hal_fuzz_case_literal(const uint8_t *data, size_t size);
+
+/**
+* @brief End a row started by hal_fuzz_case_begin().
+*/
+void hal_fuzz_case_end(void);
+
+/* Target for an API taking one string, which sees the input up to its first NUL */
+#define HAL_FUZZ_STRING_TARGET(api) \
+    int LLVMFuzzerTestOneInput(const uint8_t *data, size_t size) \
+    { \
+        char *value = hal_fuzz_string(data, size); \
+        if (value != NULL) \
+        { \
+            platform_hal_##api(value); \
+            free(value); \
+        } \
+        return 0; \
+    } \
+    void hal_fuzz_case(const uint8_t *data, size_t size) \
+    { \
+        hal_fuzz_case_begin(#api, data, size); \
+        printf(", HAL_GEN_STRING("); \
+        hal_fuzz_case_literal(data, strnlen((const char *)data, size)); \
+        printf(")"); \
+        hal_fuzz_case_end(); \
+    }
+
+#endif /* __HAL_FUZZ_H__ */
@@ -0,0 +1,90 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+* @file hal_fuzz_main.c
+* @brief Driver replacing libFuzzer, to replay inputs or print them as L1 cases.
+*
+* fuzz_<api>_replay FILE...         runs each file through the target once
+* fuzz_<api>_replay --case FILE...  prints each file as a row of src/test_l1_cases.def
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include "hal_fuzz.h"
+
+static uint8_t *read_input(const char *path, size_t *size)
+{
+    FILE *file = fopen(path, "rb");
+    uint8_t *data = NULL;
+    long length;
+
+    if (file == NULL)
+    {
+        return NULL;
+    }
+    if (fseek(file, 0, SEEK_END) == 0 && (length = ftell(file)) >= 0 && fseek(file, 0, SEEK_SET) == 0)
+    {
+        /* Exactly the input size, so the sanitizers catch reads past it */
+        data = malloc(length ? (size_t)length : 1);
+        if (data != NULL && fread(data, 1, (size_t)length, file) != (size_t)length)
+        {
+            free(data);
+            data = NULL;
+        }
+        *size = (size_t)length;
+    }
+    fclose(file);
+    return data;
+}
+
+int main(int argc, char **argv)
+{
+    int printCase = 0;
+    int result = 0;
+    size_t size = 0;
+    uint8_t *data;
+    int i;
+
+    for (i = 1; i < argc; i++)
+    {
+        if (strcmp(argv[i], "--case") == 0)
+        {
+            printCase = 1;
+            continue;
+        }
+        data = read_input(argv[i], &size);
+        if (data == NULL)
+        {
+            fprintf(stderr, "%s: cannot read\n", argv[i]);
+            result = 1;
+            continue;
+        }
+        if (printCase)
+        {
+            hal_fuzz_case(data, size);
+        }
+        else
+        {
+            LLVMFuzzerTestOneInput(data, size);
+            fprintf(stderr, "%s: %zu bytes, no fault\n", argv[i], size);
+        }
+        free(data);
+    }
+    return result;
+}
@@ -0,0 +1,182 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+* @file bench_dscp.c
+* @brief Measures the cost of getDscpClientList while the DSCP traffic generator runs and
+*        checks the START, STOP and reset semantics of the counters.
+*
+* DOCSIS counts every DSCP value the generator emits and EWAN counts only 46. After the
+* measurement DOCSIS is stopped, reset and restarted for DSCP 10 alone, and each step is
+* verified against the counters. The exit status is non zero if a check fails.
+*
+* Usage: bench_dscp [-r packets_per_s] [-t threads] [-s seconds]
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "platform_hal.h"
+#include "skeleton_dscp.h"
+
+#define DEFAULT_RATE     (4000000)
+#define DEFAULT_THREADS  (2)
+#define DEFAULT_SECONDS  (2)
+#define SETTLE_MS        (100)
+
+static DSCP_list_t gBefore;
+static DSCP_list_t gAfter;
+static int gFailures = 0;
+
+static uint64_t now_ns(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+static void sleep_ms(unsigned int ms)
+{
+  struct timespec ts = { ms / 1000, (long)(ms % 1000) * 1000000L };
+
+  nanosleep(&ts, NULL);
+}
+
+static void check(int passed, const char *what)
+{
+  printf("%-48s %s\n", what, passed ? "ok" : "FAILED");
+  gFailures += !passed;
+}
+
+static uint64_t total_bytes(const DSCP_list_t *list)
+{
+  uint64_t total = 0;
+  UINT i;
+  UINT j;
+
+  for (i = 0; i < list->numElements; i++)
+  {
+    for (j = 0; j < list->DSCP_Element[i].numClients; j++)
+    {
+      total += list->DSCP_Element[i].Client[j].rxBytes + list->DSCP_Element[i].Client[j].txBytes;
+    }
+  }
+  return total;
+}
+
+static int only_dscp(const DSCP_list_t *list, UINT dscp)
+{
+  return list->numElements == 1 && list->DSCP_Element[0].dscp_value == dscp;
+}
+
+int main(int argc, char **argv)
+{
+  uint64_t rate = DEFAULT_RATE;
+  int threads = DEFAULT_THREADS;
+  int seconds = DEFAULT_SECONDS;
+  uint64_t generated0;
+  uint64_t counted0;
+  uint64_t generated;
+  uint64_t counted;
+  uint64_t start;
+  uint64_t elapsed;
+  uint64_t collectNs = 0;
+  unsigned long collects = 0;
+  int i;
+
+  for (i = 1; i < argc; i++)
+  {
+    if (!strcmp(argv[i], "-r") && i + 1 < argc)
+    {
+      rate = strtoull(argv[++i], NULL, 10);
+    }
+    else if (!strcmp(argv[i], "-t") && i + 1 < argc)
+    {
+      threads = atoi(argv[++i]);
+    }
+    else if (!strcmp(argv[i], "-s") && i + 1 < argc)
+    {
+      seconds = atoi(argv[++i]);
+    }
+    else
+    {
+      fprintf(stderr, "usage: %s [-r packets_per_s] [-t threads] [-s seconds]\n", argv[0]);
+      return 1;
+    }
+  }
+  if (rate == 0 || threads <= 0 || seconds <= 0 || skeleton_dscp_configure(rate, threads) != 0)
+  {
+    fprintf(stderr, "usage: %s [-r packets_per_s] [-t threads] [-s seconds]\n", argv[0]);
+    return 1;
+  }
+
+  platform_hal_setDscp(DOCSIS, TRAFFIC_CNT_START, "0,10,18,26,34,46");
+  platform_hal_setDscp(EWAN, TRAFFIC_CNT_START, "46");
+  skeleton_dscp_stats(&generated0, &counted0);
+  start = now_ns();
+  do
+  {
+    uint64_t t0 = now_ns();
+
+    platform_hal_getDscpClientList(DOCSIS, &gBefore);
+    collectNs += now_ns() - t0;
+    collects++;
+    sleep_ms(10);
+  } while (now_ns() - start < (uint64_t)seconds * 1000000000ull);
+  elapsed = now_ns() - start;
+  skeleton_dscp_stats(&generated, &counted);
+
+  printf("%llu packets/s requested over %d threads\n", (unsigned long long)rate, threads);
+  printf("%12.0f packets/s generated  %12.0f packets/s counted\n",
+         (double)(generated - generated0) * 1e9 / elapsed, (double)(counted - counted0) * 1e9 / elapsed);
+  printf("getDscpClientList: %lu calls, %.2f us/call, %u DSCP values\n\n",
+         collects, (double)collectNs / collects / 1000.0, gBefore.numElements);
+
+  platform_hal_getDscpClientList(EWAN, &gAfter);
+  check(only_dscp(&gAfter, 46), "EWAN counts only the started DSCP value");
+
+  platform_hal_setDscp(DOCSIS, TRAFFIC_CNT_STOP, NULL);
+  platform_hal_getDscpClientList(DOCSIS, &gBefore);
+  sleep_ms(SETTLE_MS);
+  platform_hal_getDscpClientList(DOCSIS, &gAfter);
+  check(total_bytes(&gBefore) > 0 && total_bytes(&gBefore) == total_bytes(&gAfter), "DOCSIS counts are frozen after STOP");
+
+  platform_hal_resetDscpCounts(DOCSIS);
+  platform_hal_getDscpClientList(DOCSIS, &gAfter);
+  check(gAfter.numElements == 0, "DOCSIS counts are empty after reset");
+
+  platform_hal_getDscpClientList(EWAN, &gBefore);
+  sleep_ms(SETTLE_MS);
+  platform_hal_getDscpClientList(EWAN, &gAfter);
+  check(total_bytes(&gAfter) > total_bytes(&gBefore), "EWAN keeps counting through the DOCSIS reset");
+
+  platform_hal_setDscp(DOCSIS, TRAFFIC_CNT_START, "10");
+  sleep_ms(SETTLE_MS);
+  platform_hal_getDscpClientList(DOCSIS, &gAfter);
+  check(only_dscp(&gAfter, 10), "DOCSIS restarted for DSCP 10 counts only 10");
+
+  platform_hal_setDscp(EWAN, TRAFFIC_CNT_STOP, "46");
+  platform_hal_getDscpClientList(EWAN, &gBefore);
+  sleep_ms(SETTLE_MS);
+  platform_hal_getDscpClientList(EWAN, &gAfter);
+  check(total_bytes(&gBefore) == total_bytes(&gAfter), "EWAN counts are frozen after STOP of 46");
+
+  return gFailures ? 1 : 0;
+}
@@ -0,0 +1,235 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+* @file bench_flows.c
+* @brief Classifies synthetic packet streams against growing sets of platform_hal_qos_apply rules.
+*
+* Rules are random IPv4 and IPv6 5-tuples installed through platform_hal_qos_apply. For each
+* rule count the stream is 90% packets of installed flows and 10% packets of unknown flows,
+* and it is classified by 1, 2, 4, ... up to the requested number of threads at once. A
+* classifier that stays O(1) shows the same ns/lookup for every rule count until the table
+* outgrows the caches. The exit status is non zero if a packet gets the wrong DSCP value.
+*
+* Usage: bench_flows [-t max_threads] [-n lookups_per_thread] [rule_count ...]
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <pthread.h>
+#include "platform_hal.h"
+#include "skeleton_flow.h"
+
+#define DEFAULT_LOOKUPS  (2000000)
+#define MAX_THREADS      (64)
+#define MAX_COUNTS       (16)
+#define STREAM_PACKETS   (65536)
+#define UNKNOWN_FLOWS    (1u << 30)
+
+typedef struct
+{
+  const hal_network_params_t *stream;
+  const UINT8_t              *expected;
+  long                        lookups;
+  long                        hits;
+  long                        wrong;
+  pthread_barrier_t          *start;
+} worker_t;
+
+static hal_network_params_t gStream[STREAM_PACKETS];
+static UINT8_t gExpected[STREAM_PACKETS];
+
+static uint64_t now_ns(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+static uint64_t mix(uint64_t x)
+{
+  x += 0x9E3779B97F4A7C15ull;
+  x = (x ^ (x >> 30)) * 0xBF58476D1CE4E5B9ull;
+  x = (x ^ (x >> 27)) * 0x94D049BB133111EBull;
+  return x ^ (x >> 31);
+}
+
+/* Rule n is derived from n alone, so packets of installed flows can be regenerated */
+static void make_flow(uint64_t n, hal_network_params_t *params)
+{
+  uint64_t a = mix(n);
+  uint64_t b = mix(a);
+  int i;
+
+  memset(params, 0, sizeof(*params));
+  params->ip_version = (a & 1) ? IP_VERSION_IPV6 : IP_VERSION_IPV4;
+  params->protocol = (a & 2) ? PROTOCOL_UDP : PROTOCOL_TCP;
+  params->src_port = (UINT16_t)(1024 + (a >> 8) % 64000);
+  params->dest_port = (UINT16_t)(1 + (a >> 24) % 65535);
+  params->dscp_value = (UINT8_t)(n % 64);
+  if (params->ip_version == IP_VERSION_IPV4)
+  {
+    params->src_ip.ipv4 = (UINT32_t)(0x0A000000u | (n & 0xFFFFFF));
+    params->dest_ip.ipv4 = (UINT32_t)(0xC0000000u | (uint32_t)(b & 0xFFFFFFF));
+  }
+  else
+  {
+    for (i = 0; i < 8; i++)
+    {
+      params->src_ip.ipv6[i] = (UINT8_t)(n >> (8 * i));
+      params->src_ip.ipv6[8 + i] = (UINT8_t)(a >> (8 * i));
+      params->dest_ip.ipv6[i] = (UINT8_t)(b >> (8 * i));
+    }
+    params->src_ip.ipv6[0] = 0x20;
+    params->dest_ip.ipv6[0] = 0xFD;
+  }
+}
+
+static void *classify(void *arg)
+{
+  worker_t *worker = (worker_t *)arg;
+  long i;
+
+  pthread_barrier_wait(worker->start);
+  for (i = 0; i < worker->lookups; i++)
+  {
+    size_t index = (size_t)i & (STREAM_PACKETS - 1);
+    UINT8_t dscp = 0xFF;
+
+    if (skeleton_flow_lookup(&worker->stream[index], &dscp) == RETURN_OK)
+    {
+      worker->hits++;
+    }
+    worker->wrong += (dscp != worker->expected[index]);
+  }
+  return NULL;
+}
+
+static int run(int threads, long lookups)
+{
+  pthread_t ids[MAX_THREADS];
+  worker_t workers[MAX_THREADS];
+  pthread_barrier_t start;
+  uint64_t t0;
+  uint64_t elapsed;
+  long hits = 0;
+  long wrong = 0;
+  int i;
+
+  pthread_barrier_init(&start, NULL, (unsigned int)threads + 1);
+  for (i = 0; i < threads; i++)
+  {
+    workers[i] = (worker_t){ gStream, gExpected, lookups, 0, 0, &start };
+    pthread_create(&ids[i], NULL, classify, &workers[i]);
+  }
+  pthread_barrier_wait(&start);
+  t0 = now_ns();
+  for (i = 0; i < threads; i++)
+  {
+    pthread_join(ids[i], NULL);
+    hits += workers[i].hits;
+    wrong += workers[i].wrong;
+  }
+  elapsed = now_ns() - t0;
+  pthread_barrier_destroy(&start);
+  printf("  %2d threads  %8.2f Mlookups/s  %7.1f ns/lookup/thread  %5.1f%% hits%s\n", threads,
+         (double)lookups * threads * 1000.0 / elapsed, (double)elapsed / lookups, 100.0 * hits / ((double)lookups * threads),
+         wrong ? "  WRONG DSCP" : "");
+  return wrong != 0;
+}
+
+int main(int argc, char **argv)
+{
+  long counts[MAX_COUNTS] = { 1000, 10000, 100000, 1000000 };
+  int countCount = 4;
+  int maxThreads = (int)sysconf(_SC_NPROCESSORS_ONLN);
+  long lookups = DEFAULT_LOOKUPS;
+  long installed = 0;
+  int failures = 0;
+  int userCounts = 0;
+  int c;
+  int i;
+
+  for (i = 1; i < argc; i++)
+  {
+    if (!strcmp(argv[i], "-t") && i + 1 < argc)
+    {
+      maxThreads = atoi(argv[++i]);
+    }
+    else if (!strcmp(argv[i], "-n") && i + 1 < argc)
+    {
+      lookups = atol(argv[++i]);
+    }
+    else if (atol(argv[i]) > 0 && userCounts < MAX_COUNTS)
+    {
+      counts[userCounts++] = atol(argv[i]);
+    }
+    else
+    {
+      maxThreads = 0;
+    }
+  }
+  countCount = userCounts ? userCounts : countCount;
+  if (maxThreads <= 0 || lookups <= 0)
+  {
+    fprintf(stderr, "usage: %s [-t max_threads] [-n lookups_per_thread] [rule_count ...]\n", argv[0]);
+    return 1;
+  }
+  maxThreads = (maxThreads > MAX_THREADS) ? MAX_THREADS : maxThreads;
+
+  for (c = 0; c < countCount; c++)
+  {
+    uint64_t t0 = now_ns();
+    size_t rules;
+    size_t slots;
+    int threads;
+
+    for (; installed < counts[c]; installed++)
+    {
+      hal_network_params_t params;
+
+      make_flow((uint64_t)installed, &params);
+      if (platform_hal_qos_apply(&params) != RETURN_OK)
+      {
+        break;
+      }
+    }
+    skeleton_flow_stats(&rules, &slots);
+    printf("%zu rules in %zu slots, installed at %.0f rules/s\n", rules, slots,
+           (double)(installed - (c ? counts[c - 1] : 0)) * 1e9 / (now_ns() - t0 + 1));
+
+    for (i = 0; i < STREAM_PACKETS; i++)
+    {
+      uint64_t r = mix((uint64_t)i ^ ((uint64_t)c << 32));
+      uint64_t flow = (r % 10 != 0) ? (r >> 8) % (uint64_t)installed : UNKNOWN_FLOWS + (r >> 8) % UNKNOWN_FLOWS;
+
+      make_flow(flow, &gStream[i]);
+      gExpected[i] = (flow < (uint64_t)installed) ? gStream[i].dscp_value : 0xFF;
+      gStream[i].dscp_value = 0;
+    }
+    for (threads = 1; threads <= maxThreads; threads = (threads * 2 > maxThreads && threads < maxThreads) ? maxThreads : threads * 2)
+    {
+      failures += run(threads, lookups);
+    }
+  }
+  return failures ? 1 : 0;
+}
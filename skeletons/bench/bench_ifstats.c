@@ -0,0 +1,170 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+* @file bench_ifstats.c
+* @brief Compares the ways of collecting counters for a set of interfaces.
+*
+* - text:    per interface fopen() and scan of /proc/net/dev, as most HAL ports do today
+* - procfs:  one parse of /proc/net/dev per round through the skeleton snapshot
+* - netlink: one RTM_GETLINK dump per round through the skeleton snapshot
+*
+* Usage: bench_ifstats [-n rounds] [ifname ...]. Without names every host interface is used.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <net/if.h>
+#include "skeleton_ifstats.h"
+
+#define DEFAULT_ROUNDS  (2000)
+#define MAX_NAMES       (256)
+
+static uint64_t now_ns(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+static INT text_get(const char *ifname, PINTF_STATS pIntfStats)
+{
+  FILE *fp = fopen("/proc/net/dev", "r");
+  char line[512];
+  INT ret = RETURN_ERR;
+
+  if (fp == NULL)
+  {
+    return RETURN_ERR;
+  }
+  while (fgets(line, sizeof(line), fp) != NULL)
+  {
+    char name[IFNAMSIZ + 1];
+    unsigned long long f[10];
+
+    if (sscanf(line, " %16[^:]: %llu %llu %llu %llu %llu %llu %llu %llu %llu %llu", name,
+               &f[0], &f[1], &f[2], &f[3], &f[4], &f[5], &f[6], &f[7], &f[8], &f[9]) == 11 &&
+        !strcmp(name, ifname))
+    {
+      pIntfStats->rx_bytes = f[0];
+      pIntfStats->rx_packet = f[1];
+      pIntfStats->tx_bytes = f[8];
+      pIntfStats->tx_packet = f[9];
+      ret = RETURN_OK;
+      break;
+    }
+  }
+  fclose(fp);
+  return ret;
+}
+
+static int run_text(const char * const *names, INTF_STATS *stats, int count)
+{
+  int found = 0;
+  int i;
+
+  for (i = 0; i < count; i++)
+  {
+    found += (text_get(names[i], &stats[i]) == RETURN_OK);
+  }
+  return found;
+}
+
+static int run_skeleton(const char * const *names, INTF_STATS *stats, int count)
+{
+  INT status[MAX_NAMES];
+  int found = 0;
+  int i;
+
+  skeleton_ifstats_get_bulk(names, stats, status, count);
+  for (i = 0; i < count; i++)
+  {
+    found += (status[i] == RETURN_OK);
+  }
+  return found;
+}
+
+static void report(const char *label, int (*run)(const char * const *, INTF_STATS *, int),
+                   const char * const *names, INTF_STATS *stats, int count, int rounds)
+{
+  uint64_t start;
+  uint64_t elapsed;
+  int found = 0;
+  int r;
+
+  run(names, stats, count);
+  start = now_ns();
+  for (r = 0; r < rounds; r++)
+  {
+    found = run(names, stats, count);
+  }
+  elapsed = now_ns() - start;
+  printf("%-8s %4d/%-4d found  %10.2f us/round  %8.3f us/interface\n", label, found, count,
+         (double)elapsed / rounds / 1000.0, (double)elapsed / rounds / count / 1000.0);
+}
+
+int main(int argc, char **argv)
+{
+  static INTF_STATS stats[MAX_NAMES];
+  const char *names[MAX_NAMES];
+  struct if_nameindex *ifs = NULL;
+  int rounds = DEFAULT_ROUNDS;
+  int count = 0;
+  int i;
+
+  for (i = 1; i < argc && count < MAX_NAMES; i++)
+  {
+    if (!strcmp(argv[i], "-n") && i + 1 < argc)
+    {
+      rounds = atoi(argv[++i]);
+    }
+    else
+    {
+      names[count++] = argv[i];
+    }
+  }
+  if (count == 0)
+  {
+    ifs = if_nameindex();
+    for (i = 0; ifs != NULL && ifs[i].if_index != 0 && count < MAX_NAMES; i++)
+    {
+      names[count++] = ifs[i].if_name;
+    }
+  }
+  if (count == 0 || rounds <= 0)
+  {
+    fprintf(stderr, "usage: %s [-n rounds] [ifname ...]\n", argv[0]);
+    return 1;
+  }
+
+  printf("%d interfaces, %d rounds\n", count, rounds);
+  report("text", run_text, names, stats, count, rounds);
+  skeleton_ifstats_configure(SKELETON_IFSTATS_PROCFS, 0);
+  report("procfs", run_skeleton, names, stats, count, rounds);
+  skeleton_ifstats_configure(SKELETON_IFSTATS_NETLINK, 0);
+  report("netlink", run_skeleton, names, stats, count, rounds);
+
+  if (ifs != NULL)
+  {
+    if_freenameindex(ifs);
+  }
+  return 0;
+}
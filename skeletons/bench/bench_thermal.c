@@ -0,0 +1,199 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+* @file bench_thermal.c
+* @brief Runs a reference thermal manager against the skeleton thermal plant.
+*
+* The controller maps the fan temperature onto FAN_SPEED using the thresholds returned by
+* platform_hal_initThermal(), keeps a started fan running for FanMinRunTime, and drives
+* every fan to FAN_SPEED_MAX while any rotor is locked. The virtual clock is advanced by
+* MonitoringDelay between samples, so hours of dynamics run in milliseconds.
+*
+* Usage: bench_thermal [-t seconds] [-s fan:at_s] ... Each -s stalls a fan at a virtual time.
+* The plant must be enabled with "Thermal": { "enabled": true } in the skeleton config.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "platform_hal.h"
+#include "skeleton_clock.h"
+#include "skeleton_thermal.h"
+
+#define DEFAULT_DURATION_S  (3600)
+#define MAX_STALLS          (8)
+
+#ifdef FEATURE_RDKB_THERMAL_MANAGER
+typedef struct
+{
+  UINT fan;
+  INT  atS;
+} stall_t;
+
+static uint64_t now_ns(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+static FAN_SPEED select_speed(const THERMAL_PLATFORM_CONFIG *config, INT temp)
+{
+  if (temp >= config->FastSpeedThresh + 10)
+  {
+    return FAN_SPEED_MAX;
+  }
+  if (temp >= config->FastSpeedThresh)
+  {
+    return FAN_SPEED_FAST;
+  }
+  if (temp >= config->MediumSpeedThresh)
+  {
+    return FAN_SPEED_MEDIUM;
+  }
+  if (temp >= config->SlowSpeedThresh)
+  {
+    return FAN_SPEED_SLOW;
+  }
+  return FAN_SPEED_OFF;
+}
+
+int main(int argc, char **argv)
+{
+  THERMAL_PLATFORM_CONFIG config;
+  stall_t stalls[MAX_STALLS];
+  INT current = -1;
+  FAN_ERR err;
+  INT duration = DEFAULT_DURATION_S;
+  INT stallCount = 0;
+  INT runningSince = -1;
+  INT changes = 0;
+  INT maxTemp = -1000;
+  INT secondsAboveFast = 0;
+  INT t;
+  INT i;
+  UINT fan;
+  uint64_t start;
+  uint64_t samples = 0;
+
+  for (i = 1; i < argc; i++)
+  {
+    if (!strcmp(argv[i], "-t") && i + 1 < argc)
+    {
+      duration = atoi(argv[++i]);
+    }
+    else if (!strcmp(argv[i], "-s") && i + 1 < argc && stallCount < MAX_STALLS &&
+             sscanf(argv[++i], "%u:%d", &stalls[stallCount].fan, &stalls[stallCount].atS) == 2)
+    {
+      stallCount++;
+    }
+    else
+    {
+      fprintf(stderr, "usage: %s [-t seconds] [-s fan:at_s] ...\n", argv[0]);
+      return 1;
+    }
+  }
+  if (!skeleton_thermal_enabled())
+  {
+    fprintf(stderr, "thermal plant disabled, set \"Thermal\": { \"enabled\": true } in the skeleton config\n");
+    return 1;
+  }
+  if (platform_hal_initThermal(&config) != RETURN_OK || config.MonitoringDelay <= 0)
+  {
+    fprintf(stderr, "platform_hal_initThermal failed\n");
+    return 1;
+  }
+
+  printf("thresholds slow %d medium %d fast %d, min run %ds, monitoring every %ds\n",
+         config.SlowSpeedThresh, config.MediumSpeedThresh, config.FastSpeedThresh,
+         config.FanMinRunTime, config.MonitoringDelay);
+  printf("%8s %6s %6s %8s %8s %6s\n", "time_s", "temp", "speed", "rpm0", "rpm1", "lock");
+  start = now_ns();
+  for (t = 0; t <= duration; t += config.MonitoringDelay)
+  {
+    FAN_SPEED wanted;
+    INT temp = 0;
+    INT locked = 0;
+
+    for (i = 0; i < stallCount; i++)
+    {
+      if (stalls[i].atS >= t - config.MonitoringDelay && stalls[i].atS < t)
+      {
+        skeleton_thermal_fail_fan(stalls[i].fan, SKELETON_FAN_STALL, 0);
+      }
+    }
+    platform_hal_getFanTemperature(&temp);
+    for (fan = 0; fan < (UINT)config.FanCount; fan++)
+    {
+      locked |= (platform_hal_getRotorLock(fan) == 1);
+    }
+    samples++;
+
+    wanted = locked ? FAN_SPEED_MAX : select_speed(&config, temp);
+    if (wanted == FAN_SPEED_OFF && runningSince >= 0 && t - runningSince < config.FanMinRunTime)
+    {
+      wanted = FAN_SPEED_SLOW;
+    }
+    if ((INT)wanted != current)
+    {
+      for (fan = 0; fan < (UINT)config.FanCount; fan++)
+      {
+        platform_hal_setFanSpeed(fan, wanted, &err);
+      }
+      if (wanted == FAN_SPEED_OFF)
+      {
+        runningSince = -1;
+      }
+      else if (runningSince < 0)
+      {
+        runningSince = t;
+      }
+      current = (INT)wanted;
+      changes++;
+    }
+    if (temp > maxTemp)
+    {
+      maxTemp = temp;
+    }
+    if (temp >= config.FastSpeedThresh)
+    {
+      secondsAboveFast += config.MonitoringDelay;
+    }
+    if (config.LogInterval > 0 && t % config.LogInterval == 0)
+    {
+      printf("%8d %6d %6d %8u %8u %6d\n", t, temp, current,
+             platform_hal_getRPM(0), platform_hal_getRPM(1), locked);
+    }
+    skeleton_clock_advance((uint64_t)config.MonitoringDelay * 1000);
+  }
+
+  printf("simulated %ds in %.3f ms: %llu samples, %d speed changes, max %d C, %ds at or above %d C\n",
+         duration, (double)(now_ns() - start) / 1000000.0, (unsigned long long)samples,
+         changes, maxTemp, secondsAboveFast, config.FastSpeedThresh);
+  return 0;
+}
+#else
+int main(void)
+{
+  fprintf(stderr, "bench_thermal needs FEATURE_RDKB_THERMAL_MANAGER\n");
+  return 1;
+}
+#endif
@@ -16,529 +16,1400 @@
 * limitations under the License.
 */
 
+/**
+* @file platform_hal.c
+* @brief Stateful in-memory reference implementation of the platform HAL.
+*
+* Setters validate their arguments against the HAL specification and store the
+* result, getters return what was stored. Every mutable item is kept in a word
+* sized field that readers fetch with a single atomic load, so getters never
+* block. Setters are serialised by one mutex, which keeps read-modify-write
+* sequences (fan override vs. fan speed, access level table growth) coherent.
+*
+* Every API first passes through SKELETON_LATENCY(), which applies the delay
+* configured for it in "skeleton_config" (see skeleton_latency.h). When that file
+* enables the thermal plant (see skeleton_thermal.h), fan and temperature readings
+* come from the simulation and fan commands drive it. DSCP counts come from a
+* synthetic traffic generator when it is enabled (see skeleton_dscp.h), and
+* platform_hal_qos_apply installs its rules in a flow classifier (skeleton_flow.h).
+*
+* The image watchdog of SetDeviceCodeImageTimeout and the MACsec authentication of
+* StartMACsec run on the virtual clock (see skeleton_clock.h), so their expiry can be
+* reached by moving the clock instead of waiting.
+*/
+
 #include <string.h>
 #include <stdlib.h>
+#include <stdio.h>
+#include <stdint.h>
+#include <math.h>
 #include <setjmp.h>
+#include <pthread.h>
+#include <sys/sysinfo.h>
 #include "platform_hal.h"
+#include "skeleton_config.h"
+#include "skeleton_clock.h"
+#include "skeleton_latency.h"
+#include "skeleton_ifstats.h"
+#include "skeleton_thermal.h"
+#include "skeleton_dscp.h"
+#include "skeleton_flow.h"
+
+#define SKELETON_MAX_ETH_PORT       (4)
+#define SKELETON_MAX_FANS           (SKELETON_THERMAL_MAX_FANS)
+#define SKELETON_MAX_RADIOS         (SKELETON_THERMAL_MAX_RADIOS)
+#define SKELETON_MAX_ACCESS_ENTRIES (16)
+#define SKELETON_MAX_LED_COLOR      (6)
+#define SKELETON_MAX_DSCP           (63)
+#define SKELETON_MAX_IMAGE_TIMEOUT  (3600)
+#define SKELETON_MIN_WEBUI_TIMEOUT  (30)
+#define SKELETON_MAX_WEBUI_TIMEOUT  (86400)
+#define SKELETON_MACSEC_AUTH_MS     (5000)
+
+#define ATOMIC_LOAD(ptr)       __atomic_load_n((ptr), __ATOMIC_ACQUIRE)
+#define ATOMIC_STORE(ptr, val) __atomic_store_n((ptr), (val), __ATOMIC_RELEASE)
+
+/* LED colour, state and interval share one word so getLed never sees a torn update */
+#define LED_PACK(color, state, interval) \
+  (((uint64_t)(uint8_t)(color) << 40) | ((uint64_t)(uint8_t)(state) << 32) | (uint64_t)(uint32_t)(interval))
+#define LED_COLOR(word)    ((INT)(((word) >> 40) & 0xFF))
+#define LED_STATE(word)    ((INT)(((word) >> 32) & 0xFF))
+#define LED_INTERVAL(word) ((INT)((word) & 0xFFFFFFFF))
+
+#define ACCESS_KEY(user, intf) (((uint64_t)(uint32_t)(user) << 32) | (uint32_t)(intf))
+
+static const char *const snmpValues[] = { "rgWan", "rgDualIp", "rgLanIp" };
+static const char *const cmVariants[] = { "unknown", "pc20", "pc20genband", "pc15sip", "pc15mgcp" };
+static const char *const firmwareImages[] = { "rdkb-skeleton-firmware", "rdkb-skeleton-firmware-prev" };
+static const UINT fanSpeedRpm[] = { 0, 1500, 3000, 4500, 6000 };
+
+static const UINT dhcpv4ReqOptions[]  = { 42, 43, 58, 59, 60, 61, 100, 122, 125 };
+static const UINT dhcpv4SendOptions[] = { 60, 61, 122, 125, 242, 243 };
+static const UINT dhcpv6ReqOptions[]  = { 23, 24, 82, 83, 95, 17 };
+static const UINT dhcpv6SendOptions[] = { 15, 16, 17, 20, 31 };
+
+typedef struct
+{
+  uint64_t key;
+  ULONG    value;
+} access_entry_t;
+
+typedef struct
+{
+  BOOLEAN        telnetEnable;
+  BOOLEAN        sshEnable;
+  BOOLEAN        snmpOnboardReboot;
+  BOOLEAN        imageValid;
+  UINT           activeBank;
+  UINT           rollbacks;
+  UINT           snmpIndex;
+  UINT           cmVariantIndex;
+  ULONG          webUITimeout;
+  ULONG          factoryResetCount;
+  INT            imageTimeout;
+  INT            psmState;
+  uint64_t       led;
+  UINT           fanSpeed[SKELETON_MAX_FANS];
+  BOOLEAN        fanMaxOverride[SKELETON_MAX_FANS];
+  BOOLEAN        macsecEnable[SKELETON_MAX_ETH_PORT];
+  BOOLEAN        macsecRunning[SKELETON_MAX_ETH_PORT];
+  BOOLEAN        macsecPending[SKELETON_MAX_ETH_PORT];
+  UINT           accessCount;
+  access_entry_t access[SKELETON_MAX_ACCESS_ENTRIES];
+#ifdef FEATURE_RDKB_THERMAL_MANAGER
+  THERMAL_PLATFORM_CONFIG thermalConfig;
+#endif
+} platform_state_t;
+
+static pthread_mutex_t gStateLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_once_t gPlantOnce = PTHREAD_ONCE_INIT;
+static BOOLEAN gPlantEnabled = FALSE;
+static pthread_once_t gMacsecOnce = PTHREAD_ONCE_INIT;
+static uint64_t gMacsecAuthMs = 0;
+static skeleton_clock_deadline_t gImageWatchdog;
+static skeleton_clock_deadline_t gMacsecAuth[SKELETON_MAX_ETH_PORT];
+
+static platform_state_t gState =
+{
+  .telnetEnable      = FALSE,
+  .sshEnable         = TRUE,
+  .snmpOnboardReboot = FALSE,
+  .imageValid        = TRUE,
+  .snmpIndex         = 0,
+  .cmVariantIndex    = 1,
+  .webUITimeout      = 900,
+  .factoryResetCount = 0,
+  .imageTimeout      = 0,
+  .psmState          = 1,
+  .led               = LED_PACK(0, 1, 0),
+  .fanSpeed          = { 2, 2 },
+#ifdef FEATURE_RDKB_THERMAL_MANAGER
+  .thermalConfig     =
+  {
+    .FanCount          = SKELETON_MAX_FANS,
+    .SlowSpeedThresh   = 50,
+    .MediumSpeedThresh = 60,
+    .FastSpeedThresh   = 70,
+    .FanMinRunTime     = 60,
+    .MonitoringDelay   = 30,
+    .PowerMonitoring   = 1,
+    .LogInterval       = 300,
+  },
+#endif
+};
+
+static void state_lock(void)
+{
+  pthread_mutex_lock(&gStateLock);
+}
+
+static void state_unlock(void)
+{
+  pthread_mutex_unlock(&gStateLock);
+}
+
+static INT is_boolean(BOOLEAN value)
+{
+  return (value == TRUE || value == FALSE);
+}
+
+static INT lookup_string(const char *const *table, size_t count, const char *value)
+{
+  size_t i;
+
+  for (i = 0; i < count; i++)
+  {
+    if (!strcmp(table[i], value))
+    {
+      return (INT)i;
+    }
+  }
+  return -1;
+}
+
+static INT copy_string(CHAR *dst, ULONG maxSize, const char *src)
+{
+  size_t len = strlen(src);
+
+  if (dst == NULL || maxSize == 0 || len >= maxSize)
+  {
+    return RETURN_ERR;
+  }
+  memcpy(dst, src, len + 1);
+  return RETURN_OK;
+}
+
+static INT wan_index(WAN_INTERFACE interfaceType)
+{
+  if (interfaceType == DOCSIS)
+  {
+    return 0;
+  }
+  if (interfaceType == EWAN)
+  {
+    return 1;
+  }
+  return -1;
+}
+
+static INT valid_eth_port(INT ethPort)
+{
+  return (ethPort >= 0 && ethPort < SKELETON_MAX_ETH_PORT);
+}
+
+static INT valid_fan(UINT fanIndex)
+{
+  return (fanIndex < SKELETON_MAX_FANS);
+}
+
+static void start_thermal_plant(void)
+{
+  UINT i;
+
+  gPlantEnabled = skeleton_thermal_enabled() ? TRUE : FALSE;
+  for (i = 0; gPlantEnabled && i < SKELETON_MAX_FANS; i++)
+  {
+    skeleton_thermal_set_fan(i, fanSpeedRpm[ATOMIC_LOAD(&gState.fanSpeed[i])]);
+  }
+}
+
+/* Returns TRUE and fills the reading when the thermal plant replaces the constant values */
+static BOOLEAN thermal_plant(skeleton_thermal_reading_t *reading)
+{
+  pthread_once(&gPlantOnce, start_thermal_plant);
+  if (gPlantEnabled && reading != NULL)
+  {
+    skeleton_thermal_read(reading);
+  }
+  return gPlantEnabled;
+}
 
+/* Called with the state lock held so the plant sees commands in the order they were stored */
+static void command_fan(UINT fanIndex, UINT speedIndex)
+{
+  ATOMIC_STORE(&gState.fanSpeed[fanIndex], speedIndex);
+  if (thermal_plant(NULL))
+  {
+    skeleton_thermal_set_fan(fanIndex, fanSpeedRpm[speedIndex]);
+  }
+}
+
+/* An image still unvalidated when the watchdog expires is rolled back to the other bank */
+static void settle_image_watchdog(void)
+{
+  if (!skeleton_clock_expired(&gImageWatchdog, NULL))
+  {
+    return;
+  }
+  state_lock();
+  if (!ATOMIC_LOAD(&gState.imageValid))
+  {
+    ATOMIC_STORE(&gState.activeBank, ATOMIC_LOAD(&gState.activeBank) ^ 1);
+    ATOMIC_STORE(&gState.rollbacks, ATOMIC_LOAD(&gState.rollbacks) + 1);
+    ATOMIC_STORE(&gState.imageValid, TRUE);
+  }
+  state_unlock();
+}
+
+static void load_macsec(void)
+{
+  gMacsecAuthMs = (uint64_t)skeleton_config_number(skeleton_config_section("MACsec"), "auth_ms", SKELETON_MACSEC_AUTH_MS);
+}
+
+/* Brings up a session whose authentication outlived the StartMACsec timeout once it completes */
+static void settle_macsec(INT ethPort)
+{
+  if (!ATOMIC_LOAD(&gState.macsecPending[ethPort]))
+  {
+    return;
+  }
+  state_lock();
+  if (skeleton_clock_expired(&gMacsecAuth[ethPort], NULL))
+  {
+    ATOMIC_STORE(&gState.macsecRunning[ethPort], TRUE);
+    ATOMIC_STORE(&gState.macsecPending[ethPort], FALSE);
+  }
+  state_unlock();
+}
+
+/* Called with the state lock held */
+static void stop_macsec(INT ethPort)
+{
+  skeleton_clock_disarm(&gMacsecAuth[ethPort]);
+  ATOMIC_STORE(&gState.macsecPending[ethPort], FALSE);
+  ATOMIC_STORE(&gState.macsecRunning[ethPort], FALSE);
+}
+
+static INT memory_info(ULONG *totalMB, ULONG *freeMB)
+{
+  struct sysinfo info;
+
+  if (sysinfo(&info) != 0)
+  {
+    return RETURN_ERR;
+  }
+  *totalMB = (ULONG)(((unsigned long long)info.totalram * info.mem_unit) >> 20);
+  *freeMB = (ULONG)(((unsigned long long)info.freeram * info.mem_unit) >> 20);
+  return RETURN_OK;
+}
+
+static void free_opt_list(dhcp_opt_list *list)
+{
+  while (list != NULL)
+  {
+    dhcp_opt_list *next = list->next;
+
+    free(list->dhcp_opt_val);
+    free(list);
+    list = next;
+  }
+}
+
+static dhcp_opt_list *build_opt_list(const UINT *options, size_t count, BOOLEAN withValues)
+{
+  dhcp_opt_list *head = NULL;
+  dhcp_opt_list **tail = &head;
+  size_t i;
+
+  for (i = 0; i < count; i++)
+  {
+    dhcp_opt_list *node = (dhcp_opt_list *)calloc(1, sizeof(dhcp_opt_list));
+
+    if (node == NULL)
+    {
+      free_opt_list(head);
+      return NULL;
+    }
+    node->dhcp_opt = options[i];
+    if (withValues)
+    {
+      char value[16];
+
+      snprintf(value, sizeof(value), "opt%u", options[i]);
+      node->dhcp_opt_val = strdup(value);
+    }
+    *tail = node;
+    tail = &node->next;
+  }
+  return head;
+}
+
+static INT get_dhcp_options(const UINT *req, size_t reqCount, const UINT *send, size_t sendCount,
+                            dhcp_opt_list **req_opt_list, dhcp_opt_list **send_opt_list)
+{
+  dhcp_opt_list *reqList;
+  dhcp_opt_list *sendList;
+
+  if (req_opt_list == NULL || send_opt_list == NULL)
+  {
+    return RETURN_ERR;
+  }
+  reqList = build_opt_list(req, reqCount, FALSE);
+  sendList = build_opt_list(send, sendCount, TRUE);
+  if (reqList == NULL || sendList == NULL)
+  {
+    free_opt_list(reqList);
+    free_opt_list(sendList);
+    return RETURN_ERR;
+  }
+  *req_opt_list = reqList;
+  *send_opt_list = sendList;
+  return RETURN_OK;
+}
+
+/* Parses a comma separated DSCP list ("10,20,30") into a 64 bit membership mask */
+static INT parse_dscp_list(const char *pDscpVals, uint64_t *mask)
+{
+  const char *p = pDscpVals;
+
+  *mask = 0;
+  while (*p != '\0')
+  {
+    char *end;
+    long value = strtol(p, &end, 10);
+
+    if (end == p || value < 0 || value > SKELETON_MAX_DSCP)
+    {
+      return RETURN_ERR;
+    }
+    *mask |= (uint64_t)1 << value;
+    p = end;
+    if (*p == ',')
+    {
+      p++;
+    }
+    else if (*p != '\0')
+    {
+      return RETURN_ERR;
+    }
+  }
+  return RETURN_OK;
+}
 
 INT platform_hal_GetDeviceConfigStatus(CHAR* pValue)
 {
-  /*TODO: Implement Me!*/
-  (void)pValue;
-  return (INT)0;
+  SKELETON_LATENCY();
+  if (pValue == NULL)
+  {
+    return RETURN_ERR;
+  }
+  strcpy(pValue, "Complete");
+  return RETURN_OK;
 }
 
 INT platform_hal_GetTelnetEnable(BOOLEAN* pFlag)
 {
-  /*TODO: Implement Me!*/
-  (void)pFlag;
-  return (INT)0;
+  SKELETON_LATENCY();
+  if (pFlag == NULL)
+  {
+    return RETURN_ERR;
+  }
+  *pFlag = ATOMIC_LOAD(&gState.telnetEnable);
+  return RETURN_OK;
 }
 
 INT platform_hal_SetTelnetEnable(BOOLEAN Flag)
 {
-  /*TODO: Implement Me!*/
-  (void)Flag;
-  return (INT)0;
+  SKELETON_LATENCY();
+  if (!is_boolean(Flag))
+  {
+    return RETURN_ERR;
+  }
+  state_lock();
+  ATOMIC_STORE(&gState.telnetEnable, Flag);
+  state_unlock();
+  return RETURN_OK;
 }
 
 INT platform_hal_GetSSHEnable(BOOLEAN* pFlag)
 {
-  /*TODO: Implement Me!*/
-  (void)pFlag;
-  return (INT)0;
+  SKELETON_LATENCY();
+  if (pFlag == NULL)
+  {
+    return RETURN_ERR;
+  }
+  *pFlag = ATOMIC_LOAD(&gState.sshEnable);
+  return RETURN_OK;
 }
 
 INT platform_hal_SetSSHEnable(BOOLEAN Flag)
 {
-  /*TODO: Implement Me!*/
-  (void)Flag;
-  return (INT)0;
+  SKELETON_LATENCY();
+  if (!is_boolean(Flag))
+  {
+    return RETURN_ERR;
+  }
+  state_lock();
+  ATOMIC_STORE(&gState.sshEnable, Flag);
+  state_unlock();
+  return RETURN_OK;
 }
 
 INT platform_hal_GetSNMPEnable(CHAR* pValue)
 {
-  /*TODO: Implement Me!*/
-  (void)pValue;
-  return (INT)0;
+  SKELETON_LATENCY();
+  if (pValue == NULL)
+  {
+    return RETURN_ERR;
+  }
+  strcpy(pValue, snmpValues[ATOMIC_LOAD(&gState.snmpIndex)]);
+  return RETURN_OK;
 }
 
 INT platform_hal_SetSNMPEnable(CHAR* pValue)
 {
-  /*TODO: Implement Me!*/
-  (void)pValue;
-  return (INT)0;
+  INT index;
+
+  SKELETON_LATENCY();
+  if (pValue == NULL)
+  {
+    return RETURN_ERR;
+  }
+  index = lookup_string(snmpValues, sizeof(snmpValues) / sizeof(snmpValues[0]), pValue);
+  if (index < 0)
+  {
+    return RETURN_ERR;
+  }
+  state_lock();
+  ATOMIC_STORE(&gState.snmpIndex, (UINT)index);
+  state_unlock();
+  return RETURN_OK;
 }
 
 INT platform_hal_GetWebUITimeout(ULONG* pValue)
 {
-  /*TODO: Implement Me!*/
-  (void)pValue;
-  return (INT)0;
+  SKELETON_LATENCY();
+  if (pValue == NULL)
+  {
+    return RETURN_ERR;
+  }
+  *pValue = ATOMIC_LOAD(&gState.webUITimeout);
+  return RETURN_OK;
 }
 
 INT platform_hal_SetWebUITimeout(ULONG value)
 {
-  /*TODO: Implement Me!*/
-  (void)value;
-  return (INT)0;
+  SKELETON_LATENCY();
+  /* 0 disables the timeout, anything else must be within 30..86400 seconds */
+  if (value != 0 && (value < SKELETON_MIN_WEBUI_TIMEOUT || value > SKELETON_MAX_WEBUI_TIMEOUT))
+  {
+    return RETURN_ERR;
+  }
+  state_lock();
+  ATOMIC_STORE(&gState.webUITimeout, value);
+  state_unlock();
+  return RETURN_OK;
 }
 
 INT platform_hal_GetWebAccessLevel(INT userIndex, INT ifIndex, ULONG* pValue)
 {
-  /*TODO: Implement Me!*/
-  (void)userIndex;
-  (void)ifIndex;
-  (void)pValue;
-  return (INT)0;
+  uint64_t key = ACCESS_KEY(userIndex, ifIndex);
+  UINT count;
+  UINT i;
+
+  SKELETON_LATENCY();
+  if (pValue == NULL || userIndex < 0 || ifIndex < 0)
+  {
+    return RETURN_ERR;
+  }
+  count = ATOMIC_LOAD(&gState.accessCount);
+  for (i = 0; i < count; i++)
+  {
+    if (gState.access[i].key == key)
+    {
+      *pValue = ATOMIC_LOAD(&gState.access[i].value);
+      return RETURN_OK;
+    }
+  }
+  *pValue = 0;
+  return RETURN_OK;
 }
 
 INT platform_hal_SetWebAccessLevel(INT userIndex, INT ifIndex, ULONG value)
 {
-  /*TODO: Implement Me!*/
-  (void)userIndex;
-  (void)ifIndex;
-  (void)value;
-  return (INT)0;
+  uint64_t key = ACCESS_KEY(userIndex, ifIndex);
+  INT ret = RETURN_OK;
+  UINT count;
+  UINT i;
+
+  SKELETON_LATENCY();
+  if (userIndex < 0 || ifIndex < 0)
+  {
+    return RETURN_ERR;
+  }
+  state_lock();
+  count = gState.accessCount;
+  for (i = 0; i < count; i++)
+  {
+    if (gState.access[i].key == key)
+    {
+      break;
+    }
+  }
+  if (i < count)
+  {
+    ATOMIC_STORE(&gState.access[i].value, value);
+  }
+  else if (count < SKELETON_MAX_ACCESS_ENTRIES)
+  {
+    /* Fill the entry first, then publish it by bumping the count */
+    gState.access[count].key = key;
+    gState.access[count].value = value;
+    ATOMIC_STORE(&gState.accessCount, count + 1);
+  }
+  else
+  {
+    ret = RETURN_ERR;
+  }
+  state_unlock();
+  return ret;
 }
 
 INT platform_hal_PandMDBInit(void)
 {
-  /*TODO: Implement Me!*/
-  return (INT)0;
+  SKELETON_LATENCY();
+  return RETURN_OK;
 }
 
 INT platform_hal_DocsisParamsDBInit(void)
 {
-  /*TODO: Implement Me!*/
-  return (INT)0;
+  SKELETON_LATENCY();
+  return RETURN_OK;
 }
 
 INT platform_hal_GetModelName(CHAR* pValue)
 {
-  /*TODO: Implement Me!*/
-  (void)pValue;
-  return (INT)0;
+  SKELETON_LATENCY();
+  if (pValue == NULL)
+  {
+    return RETURN_ERR;
+  }
+  strcpy(pValue, "RDKB-SKELETON");
+  return RETURN_OK;
 }
 
 INT platform_hal_GetRouterRegion(CHAR* pValue)
 {
-  /*TODO: Implement Me!*/
-  (void)pValue;
-  return (INT)0;
+  SKELETON_LATENCY();
+  if (pValue == NULL)
+  {
+    return RETURN_ERR;
+  }
+  strcpy(pValue, "REGION_UNKNOWN");
+  return RETURN_OK;
 }
 
 INT platform_hal_GetSerialNumber(CHAR* pValue)
 {
-  /*TODO: Implement Me!*/
-  (void)pValue;
-  return (INT)0;
+  SKELETON_LATENCY();
+  if (pValue == NULL)
+  {
+    return RETURN_ERR;
+  }
+  strcpy(pValue, "SKEL00000001");
+  return RETURN_OK;
 }
 
 INT platform_hal_GetHardwareVersion(CHAR* pValue)
 {
-  /*TODO: Implement Me!*/
-  (void)pValue;
-  return (INT)0;
+  SKELETON_LATENCY();
+  if (pValue == NULL)
+  {
+    return RETURN_ERR;
+  }
+  strcpy(pValue, "1.0");
+  return RETURN_OK;
 }
 
 INT platform_hal_GetSoftwareVersion(CHAR* pValue, ULONG maxSize)
 {
-  /*TODO: Implement Me!*/
-  (void)pValue;
-  (void)maxSize;
-  return (INT)0;
+  SKELETON_LATENCY();
+  return copy_string(pValue, maxSize, "rdkb-skeleton-1.0");
 }
 
 INT platform_hal_GetBootloaderVersion(CHAR* pValue, ULONG maxSize)
 {
-  /*TODO: Implement Me!*/
-  (void)pValue;
-  (void)maxSize;
-  return (INT)0;
+  SKELETON_LATENCY();
+  return copy_string(pValue, maxSize, "skeleton-boot-1.0");
 }
 
 INT platform_hal_GetFirmwareName(CHAR* pValue, ULONG maxSize)
 {
-  /*TODO: Implement Me!*/
-  (void)pValue;
-  (void)maxSize;
-  return (INT)0;
+  SKELETON_LATENCY();
+  settle_image_watchdog();
+  return copy_string(pValue, maxSize, firmwareImages[ATOMIC_LOAD(&gState.activeBank)]);
 }
 
 INT platform_hal_GetBaseMacAddress(CHAR* pValue)
 {
-  /*TODO: Implement Me!*/
-  (void)pValue;
-  return (INT)0;
+  SKELETON_LATENCY();
+  if (pValue == NULL)
+  {
+    return RETURN_ERR;
+  }
+  strcpy(pValue, "02:00:00:00:00:01");
+  return RETURN_OK;
 }
 
 INT platform_hal_GetHardware(CHAR* pValue)
 {
-  /*TODO: Implement Me!*/
-  (void)pValue;
-  return (INT)0;
+  SKELETON_LATENCY();
+  if (pValue == NULL)
+  {
+    return RETURN_ERR;
+  }
+  /* Flash size in MB */
+  strcpy(pValue, "512");
+  return RETURN_OK;
 }
 
 INT platform_hal_GetHardware_MemUsed(CHAR* pValue)
 {
-  /*TODO: Implement Me!*/
-  (void)pValue;
-  return (INT)0;
+  ULONG totalMB;
+  ULONG freeMB;
+
+  SKELETON_LATENCY();
+  if (pValue == NULL || memory_info(&totalMB, &freeMB) != RETURN_OK)
+  {
+    return RETURN_ERR;
+  }
+  sprintf(pValue, "%lu", totalMB - freeMB);
+  return RETURN_OK;
 }
 
 INT platform_hal_GetHardware_MemFree(CHAR* pValue)
 {
-  /*TODO: Implement Me!*/
-  (void)pValue;
-  return (INT)0;
+  ULONG totalMB;
+  ULONG freeMB;
+
+  SKELETON_LATENCY();
+  if (pValue == NULL || memory_info(&totalMB, &freeMB) != RETURN_OK)
+  {
+    return RETURN_ERR;
+  }
+  sprintf(pValue, "%lu", freeMB);
+  return RETURN_OK;
 }
 
 INT platform_hal_GetTotalMemorySize(ULONG* pulSize)
 {
-  /*TODO: Implement Me!*/
-  (void)pulSize;
-  return (INT)0;
+  ULONG freeMB;
+
+  SKELETON_LATENCY();
+  if (pulSize == NULL)
+  {
+    return RETURN_ERR;
+  }
+  return memory_info(pulSize, &freeMB);
 }
 
 INT platform_hal_GetUsedMemorySize(ULONG* pulSize)
 {
-  /*TODO: Implement Me!*/
-  (void)pulSize;
-  return (INT)0;
+  ULONG totalMB;
+  ULONG freeMB;
+
+  SKELETON_LATENCY();
+  if (pulSize == NULL || memory_info(&totalMB, &freeMB) != RETURN_OK)
+  {
+    return RETURN_ERR;
+  }
+  *pulSize = totalMB - freeMB;
+  return RETURN_OK;
 }
 
 INT platform_hal_GetFreeMemorySize(ULONG* pulSize)
 {
-  /*TODO: Implement Me!*/
-  (void)pulSize;
-  return (INT)0;
+  ULONG totalMB;
+
+  SKELETON_LATENCY();
+  if (pulSize == NULL)
+  {
+    return RETURN_ERR;
+  }
+  return memory_info(&totalMB, pulSize);
 }
 
 INT platform_hal_GetFactoryResetCount(ULONG* pulSize)
 {
-  /*TODO: Implement Me!*/
-  (void)pulSize;
-  return (INT)0;
+  SKELETON_LATENCY();
+  if (pulSize == NULL)
+  {
+    return RETURN_ERR;
+  }
+  *pulSize = ATOMIC_LOAD(&gState.factoryResetCount);
+  return RETURN_OK;
 }
 
 INT platform_hal_ClearResetCount(BOOLEAN bFlag)
 {
-  /*TODO: Implement Me!*/
-  (void)bFlag;
-  return (INT)0;
+  SKELETON_LATENCY();
+  if (!is_boolean(bFlag))
+  {
+    return RETURN_ERR;
+  }
+  if (bFlag == TRUE)
+  {
+    state_lock();
+    ATOMIC_STORE(&gState.factoryResetCount, 0);
+    state_unlock();
+  }
+  return RETURN_OK;
 }
 
 INT platform_hal_getTimeOffSet(CHAR* timeOffSet)
 {
-  /*TODO: Implement Me!*/
-  (void)timeOffSet;
-  return (INT)0;
+  SKELETON_LATENCY();
+  if (timeOffSet == NULL)
+  {
+    return RETURN_ERR;
+  }
+  strcpy(timeOffSet, "-18000");
+  return RETURN_OK;
 }
 
 INT platform_hal_SetDeviceCodeImageTimeout(INT seconds)
 {
-  /*TODO: Implement Me!*/
-  (void)seconds;
-  return (INT)0;
+  SKELETON_LATENCY();
+  if (seconds < 0 || seconds > SKELETON_MAX_IMAGE_TIMEOUT)
+  {
+    return RETURN_ERR;
+  }
+  settle_image_watchdog();
+  state_lock();
+  ATOMIC_STORE(&gState.imageTimeout, seconds);
+  if (seconds > 0)
+  {
+    skeleton_clock_arm(&gImageWatchdog, (uint64_t)seconds * 1000);
+  }
+  else
+  {
+    skeleton_clock_disarm(&gImageWatchdog);
+  }
+  state_unlock();
+  return RETURN_OK;
 }
 
 INT platform_hal_SetDeviceCodeImageValid(BOOLEAN flag)
 {
-  /*TODO: Implement Me!*/
-  (void)flag;
-  return (INT)0;
+  SKELETON_LATENCY();
+  if (!is_boolean(flag))
+  {
+    return RETURN_ERR;
+  }
+  settle_image_watchdog();
+  state_lock();
+  ATOMIC_STORE(&gState.imageValid, flag);
+  if (flag == TRUE)
+  {
+    skeleton_clock_disarm(&gImageWatchdog);
+  }
+  state_unlock();
+  return RETURN_OK;
 }
 
 INT platform_hal_getFactoryPartnerId(CHAR* pValue)
 {
-  /*TODO: Implement Me!*/
-  (void)pValue;
-  return (INT)0;
+  SKELETON_LATENCY();
+  if (pValue == NULL)
+  {
+    return RETURN_ERR;
+  }
+  strcpy(pValue, "comcast");
+  return RETURN_OK;
 }
 
 INT platform_hal_getFactoryCmVariant(CHAR* pValue)
 {
-  /*TODO: Implement Me!*/
-  (void)pValue;
-  return (INT)0;
+  SKELETON_LATENCY();
+  if (pValue == NULL)
+  {
+    return RETURN_ERR;
+  }
+  strcpy(pValue, cmVariants[ATOMIC_LOAD(&gState.cmVariantIndex)]);
+  return RETURN_OK;
 }
 
 INT platform_hal_setFactoryCmVariant(CHAR* pValue)
 {
-  /*TODO: Implement Me!*/
-  (void)pValue;
-  return (INT)0;
+  INT index;
+
+  SKELETON_LATENCY();
+  if (pValue == NULL)
+  {
+    return RETURN_ERR;
+  }
+  index = lookup_string(cmVariants, sizeof(cmVariants) / sizeof(cmVariants[0]), pValue);
+  if (index < 0)
+  {
+    return RETURN_ERR;
+  }
+  state_lock();
+  ATOMIC_STORE(&gState.cmVariantIndex, (UINT)index);
+  state_unlock();
+  return RETURN_OK;
 }
 #ifdef FEATURE_RDKB_LED_MANAGER
 int platform_hal_initLed(char* config_file_name)
 {
-  /*TODO: Implement Me!*/
-  (void)config_file_name;
-  return (int)0;
+  SKELETON_LATENCY();
+  if (config_file_name == NULL)
+  {
+    return RETURN_ERR;
+  }
+  return RETURN_OK;
 }
 #endif
 INT platform_hal_setLed(PLEDMGMT_PARAMS pValue)
 {
-  /*TODO: Implement Me!*/
-  (void)pValue;
-  return (INT)0;
+  SKELETON_LATENCY();
+  if (pValue == NULL)
+  {
+    return RETURN_ERR;
+  }
+  if ((INT)pValue->LedColor < 0 || (INT)pValue->LedColor > SKELETON_MAX_LED_COLOR ||
+      (pValue->State != 0 && pValue->State != 1) || pValue->Interval < 0)
+  {
+    return RETURN_ERR;
+  }
+  state_lock();
+  ATOMIC_STORE(&gState.led, LED_PACK(pValue->LedColor, pValue->State, pValue->Interval));
+  state_unlock();
+  return RETURN_OK;
 }
 
 INT platform_hal_getLed(PLEDMGMT_PARAMS pValue)
 {
-  /*TODO: Implement Me!*/
-  (void)pValue;
-  return (INT)0;
+  uint64_t led;
+
+  SKELETON_LATENCY();
+  if (pValue == NULL)
+  {
+    return RETURN_ERR;
+  }
+  led = ATOMIC_LOAD(&gState.led);
+  pValue->LedColor = (LED_COLOR)LED_COLOR(led);
+  pValue->State = LED_STATE(led);
+  pValue->Interval = LED_INTERVAL(led);
+  return RETURN_OK;
 }
 
 UINT platform_hal_getFanSpeed(UINT fanIndex)
 {
-  /*TODO: Implement Me!*/
-  (void)fanIndex;
-  return (UINT)0;
+  SKELETON_LATENCY();
+  if (!valid_fan(fanIndex))
+  {
+    return 0;
+  }
+  return fanSpeedRpm[ATOMIC_LOAD(&gState.fanSpeed[fanIndex])];
 }
 
 UINT platform_hal_getRPM(UINT fanIndex)
 {
-  /*TODO: Implement Me!*/
-  (void)fanIndex;
-  return (UINT)0;
+  skeleton_thermal_reading_t reading;
+
+  SKELETON_LATENCY();
+  if (!valid_fan(fanIndex))
+  {
+    return 0;
+  }
+  if (thermal_plant(&reading))
+  {
+    return (UINT)lround(reading.rpm[fanIndex]);
+  }
+  return fanSpeedRpm[ATOMIC_LOAD(&gState.fanSpeed[fanIndex])];
 }
 
 INT platform_hal_getRotorLock(UINT fanIndex)
 {
-  /*TODO: Implement Me!*/
-  (void)fanIndex;
-  return (INT)0;
+  skeleton_thermal_reading_t reading;
+
+  SKELETON_LATENCY();
+  if (!valid_fan(fanIndex))
+  {
+    return -1;
+  }
+  if (thermal_plant(&reading))
+  {
+    return reading.rotorLock[fanIndex];
+  }
+  return 0;
 }
 
 BOOLEAN platform_hal_getFanStatus(UINT fanIndex)
 {
-  /*TODO: Implement Me!*/
-  (void)fanIndex;
-  return (BOOLEAN)0;
+  skeleton_thermal_reading_t reading;
+
+  SKELETON_LATENCY();
+  if (!valid_fan(fanIndex))
+  {
+    return FALSE;
+  }
+  if (thermal_plant(&reading) && reading.rotorLock[fanIndex])
+  {
+    return FALSE;
+  }
+  return (ATOMIC_LOAD(&gState.fanSpeed[fanIndex]) != 0) ? TRUE : FALSE;
 }
 
 INT platform_hal_setFanMaxOverride(BOOLEAN bOverrideFlag, UINT fanIndex)
 {
-  /*TODO: Implement Me!*/
-  (void)bOverrideFlag;
-  (void)fanIndex;
-  return (INT)0;
+  SKELETON_LATENCY();
+  if (!is_boolean(bOverrideFlag) || !valid_fan(fanIndex))
+  {
+    return RETURN_ERR;
+  }
+  state_lock();
+  ATOMIC_STORE(&gState.fanMaxOverride[fanIndex], bOverrideFlag);
+  if (bOverrideFlag == TRUE)
+  {
+    command_fan(fanIndex, (UINT)(sizeof(fanSpeedRpm) / sizeof(fanSpeedRpm[0]) - 1));
+  }
+  state_unlock();
+  return RETURN_OK;
 }
 #ifdef FEATURE_RDKB_THERMAL_MANAGER
+static INT load_thermal_config(THERMAL_PLATFORM_CONFIG* pThermalPlatformConfig)
+{
+  if (pThermalPlatformConfig == NULL)
+  {
+    return RETURN_ERR;
+  }
+  state_lock();
+  *pThermalPlatformConfig = gState.thermalConfig;
+  state_unlock();
+  return RETURN_OK;
+}
+
 INT platform_hal_initThermal(THERMAL_PLATFORM_CONFIG* pThermalPlatformConfig)
 {
-  /*TODO: Implement Me!*/
-  (void)pThermalPlatformConfig;
-  return (INT)0;
+  SKELETON_LATENCY();
+  return load_thermal_config(pThermalPlatformConfig);
 }
 
 INT platform_hal_LoadThermalConfig(THERMAL_PLATFORM_CONFIG* pThermalPlatformConfig)
 {
-  /*TODO: Implement Me!*/
-  (void)pThermalPlatformConfig;
-  return (INT)0;
+  SKELETON_LATENCY();
+  return load_thermal_config(pThermalPlatformConfig);
 }
 
 INT platform_hal_setFanSpeed(UINT fanIndex, FAN_SPEED fanSpeed, FAN_ERR* pErrReason)
 {
-  /*TODO: Implement Me!*/
-  (void)fanIndex;
-  (void)fanSpeed;
-  (void)pErrReason;
-  return (INT)0;
+  INT ret = RETURN_OK;
+
+  SKELETON_LATENCY();
+  if (pErrReason == NULL)
+  {
+    return RETURN_ERR;
+  }
+  if (!valid_fan(fanIndex) || (UINT)fanSpeed >= sizeof(fanSpeedRpm) / sizeof(fanSpeedRpm[0]))
+  {
+    *pErrReason = FAN_ERR_HW;
+    return RETURN_ERR;
+  }
+  state_lock();
+  if (gState.fanMaxOverride[fanIndex] == TRUE)
+  {
+    *pErrReason = FAN_ERR_MAX_OVERRIDE_SET;
+    ret = RETURN_ERR;
+  }
+  else
+  {
+    command_fan(fanIndex, (UINT)fanSpeed);
+    *pErrReason = FAN_ERR_NONE;
+  }
+  state_unlock();
+  return ret;
 }
 
 INT platform_hal_getFanTemperature(INT* pTemp)
 {
-  /*TODO: Implement Me!*/
-  (void)pTemp;
-  return (INT)0;
+  skeleton_thermal_reading_t reading;
+
+  SKELETON_LATENCY();
+  if (pTemp == NULL)
+  {
+    return RETURN_ERR;
+  }
+  *pTemp = thermal_plant(&reading) ? (INT)lround(reading.tempC) : 45;
+  return RETURN_OK;
 }
 
 INT platform_hal_getInputCurrent(INT* pValue)
 {
-  /*TODO: Implement Me!*/
-  (void)pValue;
-  return (INT)0;
+  skeleton_thermal_reading_t reading;
+
+  SKELETON_LATENCY();
+  if (pValue == NULL)
+  {
+    return RETURN_ERR;
+  }
+  /* Milliamps */
+  *pValue = (thermal_plant(&reading) && reading.reportInput) ? (INT)lround(reading.currentMa) : 1200;
+  return RETURN_OK;
 }
 
 INT platform_hal_getInputPower(INT* pValue)
 {
-  /*TODO: Implement Me!*/
-  (void)pValue;
-  return (INT)0;
+  skeleton_thermal_reading_t reading;
+
+  SKELETON_LATENCY();
+  if (pValue == NULL)
+  {
+    return RETURN_ERR;
+  }
+  /* Milliwatts */
+  *pValue = (thermal_plant(&reading) && reading.reportInput) ? (INT)lround(reading.loadW * 1000.0) : 14400;
+  return RETURN_OK;
 }
 
 INT platform_hal_getRadioTemperature(INT radioIndex, INT* pValue)
 {
-  /*TODO: Implement Me!*/
-  (void)radioIndex;
-  (void)pValue;
-  return (INT)0;
+  skeleton_thermal_reading_t reading;
+
+  SKELETON_LATENCY();
+  if (pValue == NULL || radioIndex < 0 || radioIndex >= SKELETON_MAX_RADIOS)
+  {
+    return RETURN_ERR;
+  }
+  *pValue = thermal_plant(&reading) ? (INT)lround(reading.radioC[radioIndex]) : 50 + radioIndex * 5;
+  return RETURN_OK;
 }
 
 INT platform_hal_getEcoModeStatus(INT radioIndex, INT *pValue)
 {
-   /*TODO: Implement Me!*/
-  (void)radioIndex;
-  (void)pValue;
-  return (INT)0;
+  SKELETON_LATENCY();
+  /* Eco mode is only modelled for the 2.4GHz (off) and 5GHz (on) radios */
+  if (pValue == NULL || radioIndex < 0 || radioIndex > 1)
+  {
+    return RETURN_ERR;
+  }
+  *pValue = radioIndex;
+  return RETURN_OK;
 }
 #endif
 INT platform_hal_SetSNMPOnboardRebootEnable(CHAR* pValue)
 {
-  /*TODO: Implement Me!*/
-  (void)pValue;
-  return (INT)0;
+  BOOLEAN enable;
+
+  SKELETON_LATENCY();
+  if (pValue == NULL)
+  {
+    return RETURN_ERR;
+  }
+  if (!strcmp(pValue, "enable"))
+  {
+    enable = TRUE;
+  }
+  else if (!strcmp(pValue, "disable"))
+  {
+    enable = FALSE;
+  }
+  else
+  {
+    return RETURN_ERR;
+  }
+  state_lock();
+  ATOMIC_STORE(&gState.snmpOnboardReboot, enable);
+  state_unlock();
+  return RETURN_OK;
 }
 
 INT platform_hal_GetMACsecEnable(INT ethPort, BOOLEAN* pFlag)
 {
-  /*TODO: Implement Me!*/
-  (void)ethPort;
-  (void)pFlag;
-  return (INT)0;
+  SKELETON_LATENCY();
+  if (pFlag == NULL || !valid_eth_port(ethPort))
+  {
+    return RETURN_ERR;
+  }
+  *pFlag = ATOMIC_LOAD(&gState.macsecEnable[ethPort]);
+  return RETURN_OK;
 }
 
 INT platform_hal_SetMACsecEnable(INT ethPort, BOOLEAN Flag)
 {
-  /*TODO: Implement Me!*/
-  (void)ethPort;
-  (void)Flag;
-  return (INT)0;
+  SKELETON_LATENCY();
+  if (!valid_eth_port(ethPort) || !is_boolean(Flag))
+  {
+    return RETURN_ERR;
+  }
+  state_lock();
+  ATOMIC_STORE(&gState.macsecEnable[ethPort], Flag);
+  if (Flag == FALSE)
+  {
+    stop_macsec(ethPort);
+  }
+  state_unlock();
+  return RETURN_OK;
 }
 
 INT platform_hal_GetMACsecOperationalStatus(INT ethPort, BOOLEAN* pFlag)
 {
-  /*TODO: Implement Me!*/
-  (void)ethPort;
-  (void)pFlag;
-  return (INT)0;
+  SKELETON_LATENCY();
+  if (pFlag == NULL || !valid_eth_port(ethPort))
+  {
+    return RETURN_ERR;
+  }
+  settle_macsec(ethPort);
+  *pFlag = ATOMIC_LOAD(&gState.macsecRunning[ethPort]);
+  return RETURN_OK;
 }
 
 INT platform_hal_StartMACsec(INT ethPort, INT timeoutSec)
 {
-  /*TODO: Implement Me!*/
-  (void)ethPort;
-  (void)timeoutSec;
-  return (INT)0;
+  SKELETON_LATENCY_TIMEOUT(timeoutSec > 0 ? (uint64_t)timeoutSec * 1000 : 0);
+  if (!valid_eth_port(ethPort) || timeoutSec < 0)
+  {
+    return RETURN_ERR;
+  }
+  pthread_once(&gMacsecOnce, load_macsec);
+  state_lock();
+  stop_macsec(ethPort);
+  /* A timeout of 0 waits for authentication; a shorter one returns with it still in progress */
+  if (timeoutSec == 0 || gMacsecAuthMs <= (uint64_t)timeoutSec * 1000)
+  {
+    ATOMIC_STORE(&gState.macsecRunning[ethPort], TRUE);
+  }
+  else
+  {
+    skeleton_clock_arm(&gMacsecAuth[ethPort], gMacsecAuthMs);
+    ATOMIC_STORE(&gState.macsecPending[ethPort], TRUE);
+  }
+  state_unlock();
+  return RETURN_OK;
 }
 
 INT platform_hal_StopMACsec(INT ethPort)
 {
-  /*TODO: Implement Me!*/
-  (void)ethPort;
-  return (INT)0;
+  SKELETON_LATENCY();
+  if (!valid_eth_port(ethPort))
+  {
+    return RETURN_ERR;
+  }
+  state_lock();
+  stop_macsec(ethPort);
+  state_unlock();
+  return RETURN_OK;
 }
 
 INT platform_hal_GetMemoryPaths(RDK_CPUS index, PPLAT_PROC_MEM_INFO* ppinfo)
 {
-  /*TODO: Implement Me!*/
-  (void)index;
-  (void)ppinfo;
-  return (INT)0;
+  SKELETON_LATENCY();
+  if (ppinfo == NULL || *ppinfo == NULL || (index != HOST_CPU && index != PEER_CPU))
+  {
+    return RETURN_ERR;
+  }
+  strcpy((*ppinfo)->dramPath, "/tmp");
+  strcpy((*ppinfo)->emmcPath1, "/nvram");
+  strcpy((*ppinfo)->emmcPath2, "/nvram2");
+  return RETURN_OK;
 }
 
 INT platform_hal_GetDhcpv4_Options(dhcp_opt_list** req_opt_list, dhcp_opt_list** send_opt_list)
 {
-  /*TODO: Implement Me!*/
-  (void)req_opt_list;
-  (void)send_opt_list;
-  return (INT)0;
+  SKELETON_LATENCY();
+  return get_dhcp_options(dhcpv4ReqOptions, sizeof(dhcpv4ReqOptions) / sizeof(dhcpv4ReqOptions[0]),
+                          dhcpv4SendOptions, sizeof(dhcpv4SendOptions) / sizeof(dhcpv4SendOptions[0]),
+                          req_opt_list, send_opt_list);
 }
 
 INT platform_hal_GetDhcpv6_Options(dhcp_opt_list** req_opt_list, dhcp_opt_list** send_opt_list)
 {
-  /*TODO: Implement Me!*/
-  (void)req_opt_list;
-  (void)send_opt_list;
-  return (INT)0;
+  SKELETON_LATENCY();
+  return get_dhcp_options(dhcpv6ReqOptions, sizeof(dhcpv6ReqOptions) / sizeof(dhcpv6ReqOptions[0]),
+                          dhcpv6SendOptions, sizeof(dhcpv6SendOptions) / sizeof(dhcpv6SendOptions[0]),
+                          req_opt_list, send_opt_list);
 }
 
 INT platform_hal_SetLowPowerModeState(PPSM_STATE pState)
 {
-  /*TODO: Implement Me!*/
-  (void)pState;
-  return (INT)0;
+  SKELETON_LATENCY();
+  if (pState == NULL || *pState <= PSM_NOT_SUPPORTED || *pState >= PSM_UNKNOWN)
+  {
+    return RETURN_ERR;
+  }
+  state_lock();
+  ATOMIC_STORE(&gState.psmState, (INT)*pState);
+  state_unlock();
+  return RETURN_OK;
 }
 
 INT platform_hal_getCMTSMac(CHAR* pValue)
 {
-  /*TODO: Implement Me!*/
-  (void)pValue;
-  return (INT)0;
+  SKELETON_LATENCY();
+  if (pValue == NULL)
+  {
+    return RETURN_ERR;
+  }
+  strcpy(pValue, "02:00:00:00:00:fe");
+  return RETURN_OK;
 }
 
 INT platform_hal_setDscp(WAN_INTERFACE interfaceType, TRAFFIC_CNT_COMMAND cmd, char* pDscpVals)
 {
-  /*TODO: Implement Me!*/
-  (void)interfaceType;
-  (void)cmd;
-  (void)pDscpVals;
-  return (INT)0;
+  INT wan = wan_index(interfaceType);
+  uint64_t mask = 0;
+
+  SKELETON_LATENCY();
+  if (wan < 0 || (cmd != TRAFFIC_CNT_START && cmd != TRAFFIC_CNT_STOP))
+  {
+    return RETURN_ERR;
+  }
+  if (cmd == TRAFFIC_CNT_START && pDscpVals == NULL)
+  {
+    return RETURN_ERR;
+  }
+  if (pDscpVals != NULL && parse_dscp_list(pDscpVals, &mask) != RETURN_OK)
+  {
+    return RETURN_ERR;
+  }
+  skeleton_dscp_set(wan, cmd, mask);
+  return RETURN_OK;
 }
 
 INT platform_hal_resetDscpCounts(WAN_INTERFACE interfaceType)
 {
-  /*TODO: Implement Me!*/
-  (void)interfaceType;
-  return (INT)0;
+  INT wan = wan_index(interfaceType);
+
+  SKELETON_LATENCY();
+  if (wan < 0)
+  {
+    return RETURN_ERR;
+  }
+  skeleton_dscp_reset(wan);
+  return RETURN_OK;
 }
 
 INT platform_hal_getDscpClientList(WAN_INTERFACE interfaceType, pDSCP_list_t pDSCP_List)
 {
-  /*TODO: Implement Me!*/
-  (void)interfaceType;
-  (void)pDSCP_List;
-  return (INT)0;
+  INT wan = wan_index(interfaceType);
+
+  SKELETON_LATENCY();
+  if (wan < 0 || pDSCP_List == NULL)
+  {
+    return RETURN_ERR;
+  }
+  skeleton_dscp_collect(wan, pDSCP_List);
+  return RETURN_OK;
 }
 
 INT platform_hal_GetCPUSpeed(char* cpuSpeed)
 {
-  /*TODO: Implement Me!*/
-  (void)cpuSpeed;
-  return (INT)0;
+  SKELETON_LATENCY();
+  if (cpuSpeed == NULL)
+  {
+    return RETURN_ERR;
+  }
+  strcpy(cpuSpeed, "1500");
+  return RETURN_OK;
 }
 
 INT platform_hal_GetFirmwareBankInfo(FW_BANK bankIndex, PFW_BANK_INFO pFW_Bankinfo)
 {
-  /*TODO: Implement Me!*/
-  (void)bankIndex;
-  (void)pFW_Bankinfo;
-  return (INT)0;
+  UINT active;
+
+  SKELETON_LATENCY();
+  if (pFW_Bankinfo == NULL)
+  {
+    return RETURN_ERR;
+  }
+  settle_image_watchdog();
+  active = ATOMIC_LOAD(&gState.activeBank);
+  if (bankIndex == ACTIVE_BANK)
+  {
+    strcpy(pFW_Bankinfo->fw_name, firmwareImages[active]);
+    if (ATOMIC_LOAD(&gState.imageValid))
+    {
+      strcpy(pFW_Bankinfo->fw_state, "Confirmed");
+    }
+    else
+    {
+      snprintf(pFW_Bankinfo->fw_state, sizeof(pFW_Bankinfo->fw_state), "TrialBoot#%u", ATOMIC_LOAD(&gState.rollbacks));
+    }
+  }
+  else if (bankIndex == INACTIVE_BANK)
+  {
+    /* The other bank holds the image a rollback would return to, or the one it left */
+    strcpy(pFW_Bankinfo->fw_name, firmwareImages[active ^ 1]);
+    snprintf(pFW_Bankinfo->fw_state, sizeof(pFW_Bankinfo->fw_state), "TrialBoot#%u", ATOMIC_LOAD(&gState.rollbacks));
+  }
+  else
+  {
+    return RETURN_ERR;
+  }
+  return RETURN_OK;
 }
 
 INT platform_hal_GetInterfaceStats(const char* ifname, PINTF_STATS pIntfStats)
 {
-  /*TODO: Implement Me!*/
-  (void)ifname;
-  (void)pIntfStats;
-  return (INT)0;
+  SKELETON_LATENCY();
+  return skeleton_ifstats_get(ifname, pIntfStats);
 }
 
 INT platform_hal_GetPppUserName(CHAR* pUserName, ULONG maxSize)
 {
-   /*TODO: Implement Me!*/
-  (void)pUserName;
-  (void)maxSize;
-  return (INT)0;
+  SKELETON_LATENCY();
+  return copy_string(pUserName, maxSize, "guest");
 }
 
 INT platform_hal_GetPppPassword(CHAR* pPassword, ULONG maxSize)
 {
-   /*TODO: Implement Me!*/
-  (void)pPassword;
-  (void)maxSize;
-  return (INT)0;
+  SKELETON_LATENCY();
+  return copy_string(pPassword, maxSize, "guest");
 }
 
 INT platform_hal_qos_apply(const hal_network_params_t *params)
 {
-  /*TODO: Implement Me!*/
-  (void)params;
-  return (INT)0;
+  SKELETON_LATENCY();
+  if (params == NULL || params->dscp_value > SKELETON_MAX_DSCP || params->src_port == 0 || params->dest_port == 0)
+  {
+    return RETURN_ERR;
+  }
+  if (params->protocol != PROTOCOL_TCP && params->protocol != PROTOCOL_UDP)
+  {
+    return RETURN_ERR;
+  }
+  if (params->ip_version == IP_VERSION_IPV4)
+  {
+    /* A populated IPv6 tail means the caller filled the wrong member of the union */
+    static const UINT8_t zero[sizeof(params->src_ip.ipv6) - sizeof(params->src_ip.ipv4)];
+
+    if (memcmp(&params->src_ip.ipv6[sizeof(params->src_ip.ipv4)], zero, sizeof(zero)) != 0 ||
+        memcmp(&params->dest_ip.ipv6[sizeof(params->dest_ip.ipv4)], zero, sizeof(zero)) != 0 ||
+        params->src_ip.ipv4 == params->dest_ip.ipv4)
+    {
+      return RETURN_ERR;
+    }
+  }
+  else if (params->ip_version == IP_VERSION_IPV6)
+  {
+    if (!memcmp(params->src_ip.ipv6, params->dest_ip.ipv6, sizeof(params->src_ip.ipv6)))
+    {
+      return RETURN_ERR;
+    }
+  }
+  else
+  {
+    return RETURN_ERR;
+  }
+  return skeleton_flow_insert(params);
 }
@@ -0,0 +1,176 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include <time.h>
+#include <pthread.h>
+#include "skeleton_config.h"
+#include "skeleton_clock.h"
+
+#define SKELETON_CLOCK_MAX_DEADLINES (32)
+
+static pthread_once_t gClockOnce = PTHREAD_ONCE_INIT;
+static pthread_mutex_t gClockLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_cond_t gClockMoved;
+static double gScale = 1.0;
+static uint64_t gStartNs;
+static uint64_t gAdvancedMs;
+static skeleton_clock_deadline_t *gDeadlines[SKELETON_CLOCK_MAX_DEADLINES];
+static int gDeadlineCount = 0;
+
+static uint64_t real_now_ns(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+static void load_clock(void)
+{
+  const cJSON *section = skeleton_config_section("Clock");
+  pthread_condattr_t attr;
+
+  gScale = skeleton_config_number(section, "scale", 1.0);
+  if (gScale < 0)
+  {
+    gScale = 0;
+  }
+  gStartNs = real_now_ns();
+  pthread_condattr_init(&attr);
+  pthread_condattr_setclock(&attr, CLOCK_MONOTONIC);
+  pthread_cond_init(&gClockMoved, &attr);
+  pthread_condattr_destroy(&attr);
+}
+
+static uint64_t now_locked(void)
+{
+  return (uint64_t)((double)(real_now_ns() - gStartNs) * gScale / 1000000.0) + gAdvancedMs;
+}
+
+uint64_t skeleton_clock_now_ms(void)
+{
+  uint64_t now;
+
+  pthread_once(&gClockOnce, load_clock);
+  pthread_mutex_lock(&gClockLock);
+  now = now_locked();
+  pthread_mutex_unlock(&gClockLock);
+  return now;
+}
+
+void skeleton_clock_advance(uint64_t ms)
+{
+  pthread_once(&gClockOnce, load_clock);
+  pthread_mutex_lock(&gClockLock);
+  gAdvancedMs += ms;
+  pthread_cond_broadcast(&gClockMoved);
+  pthread_mutex_unlock(&gClockLock);
+}
+
+void skeleton_clock_wait(uint64_t ms)
+{
+  struct timespec until;
+  uint64_t target;
+  uint64_t now;
+  uint64_t wakeNs;
+
+  pthread_once(&gClockOnce, load_clock);
+  pthread_mutex_lock(&gClockLock);
+  target = now_locked() + ms;
+  while ((now = now_locked()) < target)
+  {
+    if (gScale <= 0)
+    {
+      /* A stopped clock only moves when advanced */
+      pthread_cond_wait(&gClockMoved, &gClockLock);
+      continue;
+    }
+    wakeNs = real_now_ns() + (uint64_t)((double)(target - now) * 1000000.0 / gScale) + 1;
+    until.tv_sec = (time_t)(wakeNs / 1000000000ull);
+    until.tv_nsec = (long)(wakeNs % 1000000000ull);
+    pthread_cond_timedwait(&gClockMoved, &gClockLock, &until);
+  }
+  pthread_mutex_unlock(&gClockLock);
+}
+
+void skeleton_clock_arm(skeleton_clock_deadline_t *deadline, uint64_t delayMs)
+{
+  pthread_once(&gClockOnce, load_clock);
+  pthread_mutex_lock(&gClockLock);
+  if (!deadline->registered && gDeadlineCount < SKELETON_CLOCK_MAX_DEADLINES)
+  {
+    gDeadlines[gDeadlineCount++] = deadline;
+    deadline->registered = 1;
+  }
+  deadline->atMs = now_locked() + delayMs;
+  deadline->armed = 1;
+  pthread_mutex_unlock(&gClockLock);
+}
+
+void skeleton_clock_disarm(skeleton_clock_deadline_t *deadline)
+{
+  pthread_mutex_lock(&gClockLock);
+  deadline->armed = 0;
+  pthread_mutex_unlock(&gClockLock);
+}
+
+int skeleton_clock_expired(skeleton_clock_deadline_t *deadline, uint64_t *atMs)
+{
+  int expired;
+
+  pthread_once(&gClockOnce, load_clock);
+  pthread_mutex_lock(&gClockLock);
+  expired = deadline->armed && now_locked() >= deadline->atMs;
+  if (expired)
+  {
+    deadline->armed = 0;
+    if (atMs != NULL)
+    {
+      *atMs = deadline->atMs;
+    }
+  }
+  pthread_mutex_unlock(&gClockLock);
+  return expired;
+}
+
+int64_t skeleton_clock_skip(void)
+{
+  skeleton_clock_deadline_t *next = NULL;
+  int64_t moved = -1;
+  int i;
+
+  pthread_once(&gClockOnce, load_clock);
+  pthread_mutex_lock(&gClockLock);
+  for (i = 0; i < gDeadlineCount; i++)
+  {
+    if (gDeadlines[i]->armed && (next == NULL || gDeadlines[i]->atMs < next->atMs))
+    {
+      next = gDeadlines[i];
+    }
+  }
+  if (next != NULL)
+  {
+    uint64_t now = now_locked();
+
+    moved = (next->atMs > now) ? (int64_t)(next->atMs - now) : 0;
+    gAdvancedMs += (uint64_t)moved;
+    pthread_cond_broadcast(&gClockMoved);
+  }
+  pthread_mutex_unlock(&gClockLock);
+  return moved;
+}
@@ -0,0 +1,102 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+* @file skeleton_clock.h
+* @brief Virtual monotonic clock for the time dependent models of the Linux skeleton HAL.
+*
+* Virtual time runs "scale" times faster than CLOCK_MONOTONIC (section "Clock" of the
+* skeleton config, default 1) and can be moved forward explicitly, so a test or benchmark
+* can run minutes of simulated dynamics in milliseconds.
+*
+* Timeout driven behaviour (image watchdog, MACsec authentication) is expressed as deadlines
+* on this clock. A deadline is checked when the state it guards is read, so moving the clock
+* past it has the same effect as waiting for it, and skeleton_clock_skip() jumps straight to
+* the earliest pending one. The test harness drives the same clock when it is linked with
+* the skeleton.
+*/
+
+#ifndef __SKELETON_CLOCK_H__
+#define __SKELETON_CLOCK_H__
+
+#include <stdint.h>
+
+/**
+* @brief Return the virtual monotonic time in milliseconds.
+*/
+uint64_t skeleton_clock_now_ms(void);
+
+/**
+* @brief Move virtual time forward without waiting.
+*
+* @param[in] ms - Milliseconds to add to the virtual clock
+*/
+void skeleton_clock_advance(uint64_t ms);
+
+/**
+* @brief Block until virtual time has moved forward by ms.
+*
+* The wait lasts ms / scale of real time, and ends early when another thread advances the
+* clock past it. With a scale of 0 only skeleton_clock_advance() or skeleton_clock_skip()
+* end it.
+*
+* @param[in] ms - Virtual milliseconds to wait
+*/
+void skeleton_clock_wait(uint64_t ms);
+
+/**
+* @brief One shot deadline on the virtual clock.
+*
+* Deadlines must have static storage duration; they are registered with the clock on first use.
+*/
+typedef struct
+{
+  uint64_t atMs;        /**< Virtual time of expiry */
+  int      armed;       /**< Non zero until the deadline expires or is disarmed */
+  int      registered;  /**< Set by the clock */
+} skeleton_clock_deadline_t;
+
+/**
+* @brief Arm a deadline delayMs from now, replacing any earlier setting.
+*/
+void skeleton_clock_arm(skeleton_clock_deadline_t *deadline, uint64_t delayMs);
+
+/**
+* @brief Disarm a deadline.
+*/
+void skeleton_clock_disarm(skeleton_clock_deadline_t *deadline);
+
+/**
+* @brief Consume an expired deadline.
+*
+* @param[in]  deadline - Deadline to check
+* @param[out] atMs     - Optional, virtual time at which it expired
+*
+* @return 1 if the deadline was armed and has passed, in which case it is disarmed, 0 otherwise
+*/
+int skeleton_clock_expired(skeleton_clock_deadline_t *deadline, uint64_t *atMs);
+
+/**
+* @brief Move virtual time forward to the earliest armed deadline.
+*
+* @return Milliseconds the clock moved, 0 if the earliest deadline has already passed,
+*         -1 if no deadline is armed
+*/
+int64_t skeleton_clock_skip(void);
+
+#endif /* __SKELETON_CLOCK_H__ */
@@ -0,0 +1,105 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <pthread.h>
+#include "skeleton_config.h"
+
+static pthread_once_t gConfigOnce = PTHREAD_ONCE_INIT;
+static cJSON *gConfig = NULL;
+
+static char *read_config(const char *filename)
+{
+  FILE *file;
+  long length;
+  char *content = NULL;
+
+  file = fopen(filename, "r");
+  if (file == NULL)
+  {
+    return NULL;
+  }
+  if (fseek(file, 0, SEEK_END) == 0 && (length = ftell(file)) > 0 && fseek(file, 0, SEEK_SET) == 0)
+  {
+    content = (char *)malloc((size_t)length + 1);
+    if (content != NULL)
+    {
+      if (fread(content, 1, (size_t)length, file) != (size_t)length)
+      {
+        free(content);
+        content = NULL;
+      }
+      else
+      {
+        content[length] = '\0';
+      }
+    }
+  }
+  fclose(file);
+  return content;
+}
+
+static void load_config(void)
+{
+  const char *path = getenv(SKELETON_CONFIG_ENV);
+  char *content;
+
+  if (path == NULL)
+  {
+    path = SKELETON_CONFIG_FILE;
+  }
+  content = read_config(path);
+  if (content == NULL)
+  {
+    return;
+  }
+  gConfig = cJSON_Parse(content);
+  if (gConfig == NULL)
+  {
+    printf("skeleton: failed to parse %s, using defaults\n", path);
+  }
+  free(content);
+}
+
+const cJSON *skeleton_config_section(const char *name)
+{
+  pthread_once(&gConfigOnce, load_config);
+  return cJSON_GetObjectItem(gConfig, name);
+}
+
+double skeleton_config_number(const cJSON *object, const char *name, double defaultValue)
+{
+  const cJSON *item = cJSON_GetObjectItem(object, name);
+
+  return cJSON_IsNumber(item) ? cJSON_GetNumberValue(item) : defaultValue;
+}
+
+int skeleton_config_bool(const cJSON *object, const char *name, int defaultValue)
+{
+  const cJSON *item = cJSON_GetObjectItem(object, name);
+
+  return cJSON_IsBool(item) ? cJSON_IsTrue(item) : defaultValue;
+}
+
+const char *skeleton_config_string(const cJSON *object, const char *name, const char *defaultValue)
+{
+  const cJSON *item = cJSON_GetObjectItem(object, name);
+
+  return cJSON_IsString(item) ? item->valuestring : defaultValue;
+}
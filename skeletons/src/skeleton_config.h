@@ -0,0 +1,63 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+* @file skeleton_config.h
+* @brief Access to the optional "skeleton_config" file that tunes the Linux skeleton HAL.
+*
+* The file is JSON and is looked up in the working directory, next to "platform_config",
+* unless the PLATFORM_HAL_SKELETON_CONFIG environment variable names another path.
+* A missing file is not an error: every section then falls back to its defaults.
+*/
+
+#ifndef __SKELETON_CONFIG_H__
+#define __SKELETON_CONFIG_H__
+
+#include "cJSON.h"
+
+#define SKELETON_CONFIG_FILE "./skeleton_config"
+#define SKELETON_CONFIG_ENV  "PLATFORM_HAL_SKELETON_CONFIG"
+
+/**
+* @brief Return a top level section of the skeleton config.
+*
+* The file is parsed once on first use and kept for the lifetime of the process,
+* so the returned object must not be freed.
+*
+* @param[in] name - Section name, e.g. "Latency"
+*
+* @return The section object, or NULL if the file or the section is absent
+*/
+const cJSON *skeleton_config_section(const char *name);
+
+/**
+* @brief Read a number from a config object, falling back to a default.
+*/
+double skeleton_config_number(const cJSON *object, const char *name, double defaultValue);
+
+/**
+* @brief Read a boolean from a config object, falling back to a default.
+*/
+int skeleton_config_bool(const cJSON *object, const char *name, int defaultValue);
+
+/**
+* @brief Read a string from a config object, falling back to a default.
+*/
+const char *skeleton_config_string(const cJSON *object, const char *name, const char *defaultValue);
+
+#endif /* __SKELETON_CONFIG_H__ */
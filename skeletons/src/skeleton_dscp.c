@@ -0,0 +1,411 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <sched.h>
+#include <pthread.h>
+#include "skeleton_config.h"
+#include "skeleton_clock.h"
+#include "skeleton_dscp.h"
+
+#define DSCP_VALUES       (64)
+#define MAX_THREADS       (16)
+#define MAX_CLIENTS       (255)
+#define MAX_TRAFFIC_DSCP  (DSCP_VALUES)
+#define BATCH_PACKETS     (4096)
+#define IDLE_SLEEP_NS     (1000000)
+
+#define COUNTER(wan, dscp, client, dir) \
+  ((((size_t)(wan) * DSCP_VALUES + (dscp)) * gDscp.clients + (client)) * 2 + (dir))
+
+typedef struct
+{
+  uint64_t  seq;                         /**< Odd while a batch is being counted */
+  uint64_t  generated;
+  uint64_t  counted;
+  uint64_t  seen[SKELETON_DSCP_WANS];    /**< DSCP values this shard has counted, per WAN */
+  uint64_t *bytes;                       /**< Owned by one generator thread, see COUNTER() */
+  uint64_t  rng;
+} __attribute__((aligned(64))) dscp_shard_t;
+
+typedef struct
+{
+  pthread_mutex_t lock;
+  int             started;
+  int             enabled;
+  int             overridden;
+  uint64_t        packetsPerSecond;
+  int             threads;
+  unsigned int    clients;
+  unsigned int    dscpCount;
+  unsigned int    dscp[MAX_TRAFFIC_DSCP];
+  unsigned int    minBytes;
+  unsigned int    spanBytes;
+  unsigned int    ewanThreshold;
+  uint64_t        mask[SKELETON_DSCP_WANS];
+  uint64_t       *baseline;
+  dscp_shard_t    shards[MAX_THREADS];
+} dscp_engine_t;
+
+static dscp_engine_t gDscp =
+{
+  .lock = PTHREAD_MUTEX_INITIALIZER,
+};
+
+static const unsigned int defaultDscp[] = { 0, 10, 18, 26, 34, 46 };
+
+static uint64_t next_random(uint64_t *state)
+{
+  uint64_t z = (*state += 0x9E3779B97F4A7C15ull);
+
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+  return z ^ (z >> 31);
+}
+
+static uint64_t load_counter(const uint64_t *counter)
+{
+  return __atomic_load_n(counter, __ATOMIC_RELAXED);
+}
+
+/* Only the owning thread writes a shard, so a relaxed load and store is enough to count */
+static void add_counter(uint64_t *counter, uint64_t value)
+{
+  __atomic_store_n(counter, __atomic_load_n(counter, __ATOMIC_RELAXED) + value, __ATOMIC_RELAXED);
+}
+
+static void count_batch(dscp_shard_t *shard, unsigned int packets)
+{
+  uint64_t mask[SKELETON_DSCP_WANS];
+  uint64_t counted = 0;
+  unsigned int i;
+
+  __atomic_add_fetch(&shard->seq, 1, __ATOMIC_SEQ_CST);
+  mask[0] = __atomic_load_n(&gDscp.mask[0], __ATOMIC_SEQ_CST);
+  mask[1] = __atomic_load_n(&gDscp.mask[1], __ATOMIC_SEQ_CST);
+  for (i = 0; (mask[0] | mask[1]) != 0 && i < packets; i++)
+  {
+    uint64_t r = next_random(&shard->rng);
+    unsigned int client = (unsigned int)(((r & 0xFFFF) * gDscp.clients) >> 16);
+    unsigned int dscp = gDscp.dscp[(((r >> 16) & 0xFFFF) * gDscp.dscpCount) >> 16];
+    unsigned int wan = (((r >> 32) & 0xFFFF) < gDscp.ewanThreshold) ? 1 : 0;
+    unsigned int size = gDscp.minBytes + (unsigned int)((((r >> 48) & 0x7FFF) * gDscp.spanBytes) >> 15);
+    unsigned int dir = (unsigned int)(r >> 63);
+    uint64_t bit = (uint64_t)1 << dscp;
+
+    if (!(mask[wan] & bit))
+    {
+      continue;
+    }
+    if (!(load_counter(&shard->seen[wan]) & bit))
+    {
+      __atomic_store_n(&shard->seen[wan], load_counter(&shard->seen[wan]) | bit, __ATOMIC_RELAXED);
+    }
+    add_counter(&shard->bytes[COUNTER(wan, dscp, client, dir)], size);
+    counted++;
+  }
+  add_counter(&shard->generated, packets);
+  add_counter(&shard->counted, counted);
+  __atomic_add_fetch(&shard->seq, 1, __ATOMIC_RELEASE);
+}
+
+static void *generate(void *arg)
+{
+  dscp_shard_t *shard = (dscp_shard_t *)arg;
+  uint64_t rate = gDscp.packetsPerSecond / (uint64_t)gDscp.threads;
+  uint64_t startMs = skeleton_clock_now_ms();
+  uint64_t produced = 0;
+
+  if (rate == 0)
+  {
+    rate = 1;
+  }
+  for (;;)
+  {
+    uint64_t due = (skeleton_clock_now_ms() - startMs) * rate / 1000;
+    struct timespec idle = { 0, IDLE_SLEEP_NS };
+
+    if (due <= produced)
+    {
+      nanosleep(&idle, NULL);
+      continue;
+    }
+    /* A generator that cannot keep up drops everything older than 100 ms rather than bursting */
+    if (due - produced > rate / 10 + BATCH_PACKETS)
+    {
+      produced = due - rate / 10;
+    }
+    if (due - produced > BATCH_PACKETS)
+    {
+      due = produced + BATCH_PACKETS;
+    }
+    count_batch(shard, (unsigned int)(due - produced));
+    produced = due;
+  }
+  return NULL;
+}
+
+/* Waits until every batch that may have read the old masks has been counted */
+static void quiesce(void)
+{
+  int i;
+
+  for (i = 0; i < gDscp.threads; i++)
+  {
+    uint64_t seq = __atomic_load_n(&gDscp.shards[i].seq, __ATOMIC_SEQ_CST);
+
+    while ((seq & 1) && __atomic_load_n(&gDscp.shards[i].seq, __ATOMIC_ACQUIRE) == seq)
+    {
+      sched_yield();
+    }
+  }
+}
+
+static void load_generator(void)
+{
+  const cJSON *section = skeleton_config_section("Dscp");
+  const cJSON *values = cJSON_GetObjectItem(section, "dscp");
+  double clients = skeleton_config_number(section, "clients", 16);
+  double threads = skeleton_config_number(section, "threads", 2);
+  double minBytes = skeleton_config_number(section, "min_bytes", 64);
+  double maxBytes = skeleton_config_number(section, "max_bytes", 1500);
+  double share = skeleton_config_number(section, "ewan_share", 0.5);
+  int i;
+
+  if (!gDscp.overridden)
+  {
+    gDscp.enabled = skeleton_config_bool(section, "enabled", 0);
+    gDscp.packetsPerSecond = (uint64_t)skeleton_config_number(section, "packets_per_s", 1000000);
+    gDscp.threads = (threads < 1) ? 1 : (threads > MAX_THREADS) ? MAX_THREADS : (int)threads;
+  }
+  gDscp.clients = (clients < 1) ? 1 : (clients > MAX_CLIENTS) ? MAX_CLIENTS : (unsigned int)clients;
+  for (i = 0; cJSON_IsArray(values) && i < cJSON_GetArraySize(values) && gDscp.dscpCount < MAX_TRAFFIC_DSCP; i++)
+  {
+    const cJSON *value = cJSON_GetArrayItem(values, i);
+
+    if (cJSON_IsNumber(value) && value->valueint >= 0 && value->valueint < DSCP_VALUES)
+    {
+      gDscp.dscp[gDscp.dscpCount++] = (unsigned int)value->valueint;
+    }
+  }
+  if (gDscp.dscpCount == 0)
+  {
+    memcpy(gDscp.dscp, defaultDscp, sizeof(defaultDscp));
+    gDscp.dscpCount = sizeof(defaultDscp) / sizeof(defaultDscp[0]);
+  }
+  gDscp.minBytes = (minBytes < 1) ? 1 : (unsigned int)minBytes;
+  gDscp.spanBytes = (maxBytes > minBytes) ? (unsigned int)(maxBytes - minBytes) : 0;
+  gDscp.ewanThreshold = (share <= 0) ? 0 : (share >= 1) ? 0x10000 : (unsigned int)(share * 0x10000);
+}
+
+static void start_generator_locked(void)
+{
+  size_t counters;
+  uint64_t seed = (uint64_t)time(NULL);
+  int i;
+
+  load_generator();
+  counters = (size_t)SKELETON_DSCP_WANS * DSCP_VALUES * gDscp.clients * 2;
+  gDscp.baseline = (uint64_t *)calloc(counters, sizeof(uint64_t));
+  for (i = 0; gDscp.enabled && gDscp.baseline != NULL && i < gDscp.threads; i++)
+  {
+    dscp_shard_t *shard = &gDscp.shards[i];
+    pthread_t thread;
+
+    shard->rng = seed ^ ((uint64_t)(i + 1) << 32);
+    shard->bytes = (uint64_t *)calloc(counters, sizeof(uint64_t));
+    if (shard->bytes == NULL || pthread_create(&thread, NULL, generate, shard) != 0)
+    {
+      free(shard->bytes);
+      shard->bytes = NULL;
+      break;
+    }
+    pthread_detach(thread);
+  }
+  gDscp.threads = i;
+  if (gDscp.enabled && gDscp.threads == 0)
+  {
+    printf("DSCP traffic generator failed to start\n");
+  }
+  __atomic_store_n(&gDscp.started, 1, __ATOMIC_RELEASE);
+}
+
+static void ensure_started(void)
+{
+  if (__atomic_load_n(&gDscp.started, __ATOMIC_ACQUIRE))
+  {
+    return;
+  }
+  pthread_mutex_lock(&gDscp.lock);
+  if (!gDscp.started)
+  {
+    start_generator_locked();
+  }
+  pthread_mutex_unlock(&gDscp.lock);
+}
+
+int skeleton_dscp_configure(uint64_t packetsPerSecond, int threads)
+{
+  int result = -1;
+
+  pthread_mutex_lock(&gDscp.lock);
+  if (!gDscp.started)
+  {
+    gDscp.overridden = 1;
+    gDscp.enabled = 1;
+    gDscp.packetsPerSecond = packetsPerSecond;
+    gDscp.threads = (threads < 1) ? 1 : (threads > MAX_THREADS) ? MAX_THREADS : threads;
+    result = 0;
+  }
+  pthread_mutex_unlock(&gDscp.lock);
+  return result;
+}
+
+void skeleton_dscp_set(int wan, TRAFFIC_CNT_COMMAND cmd, uint64_t mask)
+{
+  uint64_t counted;
+
+  ensure_started();
+  pthread_mutex_lock(&gDscp.lock);
+  counted = __atomic_load_n(&gDscp.mask[wan], __ATOMIC_RELAXED);
+  if (cmd == TRAFFIC_CNT_START)
+  {
+    counted |= mask;
+  }
+  else
+  {
+    counted = (mask != 0) ? (counted & ~mask) : 0;
+  }
+  __atomic_store_n(&gDscp.mask[wan], counted, __ATOMIC_SEQ_CST);
+  quiesce();
+  pthread_mutex_unlock(&gDscp.lock);
+}
+
+/* Sums the shards for one counter; called with gDscp.lock held */
+static uint64_t total_locked(size_t index)
+{
+  uint64_t total = 0;
+  int i;
+
+  for (i = 0; i < gDscp.threads; i++)
+  {
+    total += load_counter(&gDscp.shards[i].bytes[index]);
+  }
+  return total;
+}
+
+static uint64_t seen_locked(int wan)
+{
+  uint64_t seen = 0;
+  int i;
+
+  for (i = 0; i < gDscp.threads; i++)
+  {
+    seen |= load_counter(&gDscp.shards[i].seen[wan]);
+  }
+  return seen;
+}
+
+void skeleton_dscp_reset(int wan)
+{
+  uint64_t seen;
+  unsigned int dscp;
+  unsigned int client;
+
+  ensure_started();
+  pthread_mutex_lock(&gDscp.lock);
+  seen = seen_locked(wan);
+  for (dscp = 0; dscp < DSCP_VALUES; dscp++)
+  {
+    if (!((seen >> dscp) & 1))
+    {
+      continue;
+    }
+    for (client = 0; client < gDscp.clients; client++)
+    {
+      gDscp.baseline[COUNTER(wan, dscp, client, 0)] = total_locked(COUNTER(wan, dscp, client, 0));
+      gDscp.baseline[COUNTER(wan, dscp, client, 1)] = total_locked(COUNTER(wan, dscp, client, 1));
+    }
+  }
+  pthread_mutex_unlock(&gDscp.lock);
+}
+
+void skeleton_dscp_collect(int wan, pDSCP_list_t pDSCP_List)
+{
+  uint64_t seen;
+  unsigned int dscp;
+  unsigned int client;
+
+  pDSCP_List->numElements = 0;
+  ensure_started();
+  pthread_mutex_lock(&gDscp.lock);
+  seen = seen_locked(wan);
+  for (dscp = 0; dscp < DSCP_VALUES; dscp++)
+  {
+    DSCP_Element_t *element = &pDSCP_List->DSCP_Element[pDSCP_List->numElements];
+
+    if (!((seen >> dscp) & 1))
+    {
+      continue;
+    }
+    element->dscp_value = dscp;
+    element->numClients = 0;
+    for (client = 0; client < gDscp.clients; client++)
+    {
+      size_t rx = COUNTER(wan, dscp, client, 0);
+      size_t tx = COUNTER(wan, dscp, client, 1);
+      uint64_t rxBytes = total_locked(rx) - gDscp.baseline[rx];
+      uint64_t txBytes = total_locked(tx) - gDscp.baseline[tx];
+      Traffic_client_t *entry = &element->Client[element->numClients];
+
+      if (rxBytes == 0 && txBytes == 0)
+      {
+        continue;
+      }
+      snprintf(entry->mac, sizeof(entry->mac), "02:00:00:00:%02x:%02x",
+               (unsigned char)(wan + 1), (unsigned char)(client + 1));
+      entry->rxBytes = rxBytes;
+      entry->txBytes = txBytes;
+      element->numClients++;
+    }
+    if (element->numClients > 0)
+    {
+      pDSCP_List->numElements++;
+    }
+  }
+  pthread_mutex_unlock(&gDscp.lock);
+}
+
+void skeleton_dscp_stats(uint64_t *generated, uint64_t *counted)
+{
+  int i;
+
+  ensure_started();
+  *generated = 0;
+  *counted = 0;
+  pthread_mutex_lock(&gDscp.lock);
+  for (i = 0; i < gDscp.threads; i++)
+  {
+    *generated += load_counter(&gDscp.shards[i].generated);
+    *counted += load_counter(&gDscp.shards[i].counted);
+  }
+  pthread_mutex_unlock(&gDscp.lock);
+}
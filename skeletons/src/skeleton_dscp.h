@@ -0,0 +1,97 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+* @file skeleton_dscp.h
+* @brief Synthetic DSCP traffic accounting behind setDscp, resetDscpCounts and getDscpClientList.
+*
+* Generator threads produce packets for a set of synthetic clients, each packet picking a WAN,
+* a client, a DSCP value, a direction and a size. A packet is counted per DSCP value and client
+* when counting has been started for its DSCP value on its WAN. Every generator thread owns a
+* shard of the counters, so counting never contends; getDscpClientList sums the shards. The
+* generator is enabled by the "Dscp" section of the skeleton config:
+*
+* | key            | default               | meaning                                         |
+* | -------------- | --------------------- | ----------------------------------------------- |
+* | enabled        | false                 | Run the traffic generator                       |
+* | packets_per_s  | 1000000               | Packet rate over all generator threads          |
+* | threads        | 2                     | Generator threads, one counter shard each       |
+* | clients        | 16                    | Synthetic clients, 1 to 255                     |
+* | dscp           | 0,10,18,26,34,46      | DSCP values carried by the traffic              |
+* | min_bytes      | 64                    | Smallest packet                                 |
+* | max_bytes      | 1500                  | Largest packet                                  |
+* | ewan_share     | 0.5                   | Fraction of the packets on EWAN, DOCSIS gets the rest |
+*
+* TRAFFIC_CNT_START adds DSCP values to the counted set of a WAN, TRAFFIC_CNT_STOP removes
+* them (all of them for an empty list). Counts are kept across START and STOP until reset.
+* Both take effect for every packet after the call returns.
+*/
+
+#ifndef __SKELETON_DSCP_H__
+#define __SKELETON_DSCP_H__
+
+#include <stdint.h>
+#include "platform_hal.h"
+
+#define SKELETON_DSCP_WANS (2)
+
+/**
+* @brief Override the generator settings read from the skeleton config and enable it.
+*
+* Only effective before the first DSCP call starts the generator. Used by the skeleton benchmarks.
+*
+* @param[in] packetsPerSecond - Packet rate over all generator threads
+* @param[in] threads          - Number of generator threads
+*
+* @return 0 on success, -1 when the generator is already running
+*/
+int skeleton_dscp_configure(uint64_t packetsPerSecond, int threads);
+
+/**
+* @brief Start or stop counting a set of DSCP values on one WAN.
+*
+* @param[in] wan  - 0 for DOCSIS, 1 for EWAN
+* @param[in] cmd  - TRAFFIC_CNT_START or TRAFFIC_CNT_STOP
+* @param[in] mask - Bit n selects DSCP value n, 0 with TRAFFIC_CNT_STOP stops every value
+*/
+void skeleton_dscp_set(int wan, TRAFFIC_CNT_COMMAND cmd, uint64_t mask);
+
+/**
+* @brief Clear the counts of one WAN.
+*
+* @param[in] wan - 0 for DOCSIS, 1 for EWAN
+*/
+void skeleton_dscp_reset(int wan);
+
+/**
+* @brief Report the counts of one WAN since its last reset.
+*
+* Lists the DSCP values in ascending order with, for each, the clients that sent or
+* received counted traffic.
+*
+* @param[in]  wan        - 0 for DOCSIS, 1 for EWAN
+* @param[out] pDSCP_List - Counts per DSCP value and client
+*/
+void skeleton_dscp_collect(int wan, pDSCP_list_t pDSCP_List);
+
+/**
+* @brief Return the packets generated and counted so far by all generator threads.
+*/
+void skeleton_dscp_stats(uint64_t *generated, uint64_t *counted);
+
+#endif /* __SKELETON_DSCP_H__ */
@@ -0,0 +1,229 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+#include <pthread.h>
+#include "skeleton_flow.h"
+
+#define INITIAL_SLOTS  (1024)
+#define TAG_FULL       (0x80000000u)
+
+typedef struct
+{
+  uint8_t  src[16];
+  uint8_t  dst[16];
+  uint16_t srcPort;
+  uint16_t destPort;
+  uint8_t  protocol;
+  uint8_t  version;
+  uint8_t  pad[2];
+} flow_key_t;
+
+typedef struct
+{
+  uint32_t   tag;    /**< 0 while empty, TAG_FULL | hash once key is valid */
+  uint8_t    dscp;
+  flow_key_t key;
+} flow_slot_t;
+
+typedef struct flow_table
+{
+  size_t             mask;
+  flow_slot_t       *slots;
+  struct flow_table *retired;
+} flow_table_t;
+
+static pthread_mutex_t gFlowLock = PTHREAD_MUTEX_INITIALIZER;
+static flow_table_t *gTable = NULL;
+static size_t gRules = 0;
+
+static void make_key(const hal_network_params_t *params, flow_key_t *key)
+{
+  memset(key, 0, sizeof(*key));
+  if (params->ip_version == IP_VERSION_IPV4)
+  {
+    memcpy(key->src, &params->src_ip.ipv4, sizeof(params->src_ip.ipv4));
+    memcpy(key->dst, &params->dest_ip.ipv4, sizeof(params->dest_ip.ipv4));
+  }
+  else
+  {
+    memcpy(key->src, params->src_ip.ipv6, sizeof(key->src));
+    memcpy(key->dst, params->dest_ip.ipv6, sizeof(key->dst));
+  }
+  key->srcPort = params->src_port;
+  key->destPort = params->dest_port;
+  key->protocol = (uint8_t)params->protocol;
+  key->version = (uint8_t)params->ip_version;
+}
+
+static uint32_t hash_key(const flow_key_t *key)
+{
+  uint64_t words[sizeof(flow_key_t) / sizeof(uint64_t)];
+  uint64_t h = 0x9E3779B97F4A7C15ull;
+  size_t i;
+
+  memcpy(words, key, sizeof(words));
+  for (i = 0; i < sizeof(words) / sizeof(words[0]); i++)
+  {
+    h = (h ^ words[i]) * 0xBF58476D1CE4E5B9ull;
+    h ^= h >> 31;
+  }
+  return (uint32_t)(h ^ (h >> 32)) | TAG_FULL;
+}
+
+static flow_table_t *new_table(size_t slots)
+{
+  flow_table_t *table = (flow_table_t *)calloc(1, sizeof(flow_table_t));
+
+  if (table == NULL)
+  {
+    return NULL;
+  }
+  table->slots = (flow_slot_t *)calloc(slots, sizeof(flow_slot_t));
+  if (table->slots == NULL)
+  {
+    free(table);
+    return NULL;
+  }
+  table->mask = slots - 1;
+  return table;
+}
+
+/* Returns the slot holding key, or the empty slot where it belongs with *found cleared */
+static flow_slot_t *probe(const flow_table_t *table, const flow_key_t *key, uint32_t tag, int *found)
+{
+  size_t i = tag & table->mask;
+
+  for (;;)
+  {
+    flow_slot_t *slot = &table->slots[i];
+    uint32_t slotTag = __atomic_load_n(&slot->tag, __ATOMIC_ACQUIRE);
+
+    if (slotTag == 0 || (slotTag == tag && !memcmp(&slot->key, key, sizeof(*key))))
+    {
+      *found = (slotTag != 0);
+      return slot;
+    }
+    i = (i + 1) & table->mask;
+  }
+}
+
+static void place(flow_table_t *table, const flow_key_t *key, uint32_t tag, uint8_t dscp)
+{
+  int found;
+  flow_slot_t *slot = probe(table, key, tag, &found);
+
+  __atomic_store_n(&slot->dscp, dscp, __ATOMIC_RELAXED);
+  if (!found)
+  {
+    slot->key = *key;
+    __atomic_store_n(&slot->tag, tag, __ATOMIC_RELEASE);
+  }
+}
+
+/* Called with gFlowLock held; the new table is published only once it is complete */
+static INT grow_locked(void)
+{
+  size_t slots = (gTable != NULL) ? (gTable->mask + 1) * 2 : INITIAL_SLOTS;
+  flow_table_t *table = new_table(slots);
+  size_t i;
+
+  if (table == NULL)
+  {
+    return RETURN_ERR;
+  }
+  for (i = 0; gTable != NULL && i <= gTable->mask; i++)
+  {
+    const flow_slot_t *slot = &gTable->slots[i];
+
+    if (slot->tag != 0)
+    {
+      place(table, &slot->key, slot->tag, __atomic_load_n(&slot->dscp, __ATOMIC_RELAXED));
+    }
+  }
+  table->retired = gTable;
+  __atomic_store_n(&gTable, table, __ATOMIC_RELEASE);
+  return RETURN_OK;
+}
+
+INT skeleton_flow_insert(const hal_network_params_t *params)
+{
+  flow_key_t key;
+  uint32_t tag;
+  INT ret = RETURN_OK;
+
+  make_key(params, &key);
+  tag = hash_key(&key);
+  pthread_mutex_lock(&gFlowLock);
+  if (gTable == NULL || (gRules + 1) * 2 > gTable->mask + 1)
+  {
+    ret = (gRules < SKELETON_FLOW_MAX_RULES) ? grow_locked() : RETURN_ERR;
+  }
+  if (gTable != NULL)
+  {
+    int found;
+    flow_slot_t *slot = probe(gTable, &key, tag, &found);
+
+    if (!found && ret == RETURN_OK)
+    {
+      gRules++;
+      place(gTable, &key, tag, params->dscp_value);
+    }
+    else if (found)
+    {
+      /* Updating an installed rule needs no room */
+      __atomic_store_n(&slot->dscp, params->dscp_value, __ATOMIC_RELAXED);
+      ret = RETURN_OK;
+    }
+  }
+  pthread_mutex_unlock(&gFlowLock);
+  return ret;
+}
+
+INT skeleton_flow_lookup(const hal_network_params_t *packet, UINT8_t *dscp)
+{
+  const flow_table_t *table = __atomic_load_n(&gTable, __ATOMIC_ACQUIRE);
+  const flow_slot_t *slot;
+  flow_key_t key;
+  uint32_t tag;
+  int found;
+
+  if (table == NULL)
+  {
+    return RETURN_ERR;
+  }
+  make_key(packet, &key);
+  tag = hash_key(&key);
+  slot = probe(table, &key, tag, &found);
+  if (!found)
+  {
+    return RETURN_ERR;
+  }
+  *dscp = __atomic_load_n(&slot->dscp, __ATOMIC_RELAXED);
+  return RETURN_OK;
+}
+
+void skeleton_flow_stats(size_t *rules, size_t *slots)
+{
+  pthread_mutex_lock(&gFlowLock);
+  *rules = gRules;
+  *slots = (gTable != NULL) ? gTable->mask + 1 : 0;
+  pthread_mutex_unlock(&gFlowLock);
+}
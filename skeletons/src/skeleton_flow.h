@@ -0,0 +1,64 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+* @file skeleton_flow.h
+* @brief Exact match flow classifier behind platform_hal_qos_apply on the Linux skeleton.
+*
+* Each rule maps an IPv4 or IPv6 5-tuple (addresses, ports, protocol) to a DSCP value. Rules
+* live in an open addressing hash table with linear probing that doubles when half full, so
+* a lookup costs one hash and, on average, less than two probes whatever the number of rules.
+* Slots are written once and published with a release store, which lets any number of
+* threads classify without locks while rules are added; adding a rule for an existing tuple
+* changes its DSCP value. Tables outgrown by a resize are kept until exit because a lookup
+* may still be reading them.
+*/
+
+#ifndef __SKELETON_FLOW_H__
+#define __SKELETON_FLOW_H__
+
+#include <stddef.h>
+#include "platform_hal.h"
+
+#define SKELETON_FLOW_MAX_RULES (1 << 20)
+
+/**
+* @brief Install a rule, or update the DSCP value of the rule with the same 5-tuple.
+*
+* @param[in] params - Validated rule, dscp_value is the value to apply
+*
+* @return RETURN_OK on success, RETURN_ERR when SKELETON_FLOW_MAX_RULES are installed or memory runs out
+*/
+INT skeleton_flow_insert(const hal_network_params_t *params);
+
+/**
+* @brief Classify a packet against the installed rules.
+*
+* @param[in]  packet - 5-tuple of the packet, dscp_value is ignored
+* @param[out] dscp   - DSCP value of the matching rule
+*
+* @return RETURN_OK when a rule matches, RETURN_ERR otherwise
+*/
+INT skeleton_flow_lookup(const hal_network_params_t *packet, UINT8_t *dscp);
+
+/**
+* @brief Return the number of installed rules and the number of slots of the table.
+*/
+void skeleton_flow_stats(size_t *rules, size_t *slots);
+
+#endif /* __SKELETON_FLOW_H__ */
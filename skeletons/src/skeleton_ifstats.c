@@ -0,0 +1,509 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include <string.h>
+#include <stdlib.h>
+#include <stdint.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <time.h>
+#include <pthread.h>
+#include <net/if.h>
+#include <sys/socket.h>
+#include <linux/netlink.h>
+#include <linux/rtnetlink.h>
+#include <linux/if_link.h>
+#include "skeleton_config.h"
+#include "skeleton_ifstats.h"
+
+#define PROC_NET_DEV          "/proc/net/dev"
+#define DEFAULT_FRESHNESS_MS  (500)
+#define MAX_ROWS              (256)
+#define INDEX_SIZE            (2 * MAX_ROWS)
+#define NETLINK_BUF_SIZE      (32 * 1024)
+
+typedef struct
+{
+  char     name[IFNAMSIZ];
+  uint64_t rxBytes;
+  uint64_t rxPackets;
+  uint64_t txBytes;
+  uint64_t txPackets;
+} ifstats_row_t;
+
+typedef struct
+{
+  pthread_mutex_t lock;
+  skeleton_ifstats_provider_t provider;
+  int             fd;
+  int             nlFd;
+  uint32_t        nlSeq;
+  char           *buf;
+  size_t          bufSize;
+  uint64_t        loadedAtMs;
+  uint64_t        freshnessMs;
+  int             rowCount;
+  ifstats_row_t   rows[MAX_ROWS];
+  int16_t         index[INDEX_SIZE];    /* row number + 1, 0 marks a free slot */
+} ifstats_cache_t;
+
+static ifstats_cache_t gCache =
+{
+  .lock = PTHREAD_MUTEX_INITIALIZER,
+  .fd = -1,
+  .nlFd = -1,
+};
+
+static pthread_once_t gIfstatsOnce = PTHREAD_ONCE_INIT;
+
+static void load_settings(void)
+{
+  const cJSON *section = skeleton_config_section("InterfaceStats");
+  const char *provider = skeleton_config_string(section, "provider", "procfs");
+
+  gCache.freshnessMs = (uint64_t)skeleton_config_number(section, "freshness_ms", DEFAULT_FRESHNESS_MS);
+  gCache.provider = strcmp(provider, "netlink") ? SKELETON_IFSTATS_PROCFS : SKELETON_IFSTATS_NETLINK;
+}
+
+static uint64_t now_ms(void)
+{
+  struct timespec ts;
+
+  clock_gettime(CLOCK_MONOTONIC, &ts);
+  return (uint64_t)ts.tv_sec * 1000 + (uint64_t)ts.tv_nsec / 1000000;
+}
+
+static uint32_t hash_name(const char *name)
+{
+  uint32_t hash = 2166136261u;
+
+  while (*name != '\0')
+  {
+    hash = (hash ^ (uint8_t)*name++) * 16777619u;
+  }
+  return hash;
+}
+
+static void rebuild_index(void)
+{
+  int row;
+
+  memset(gCache.index, 0, sizeof(gCache.index));
+  for (row = 0; row < gCache.rowCount; row++)
+  {
+    uint32_t slot = hash_name(gCache.rows[row].name) % INDEX_SIZE;
+
+    while (gCache.index[slot] != 0)
+    {
+      slot = (slot + 1) % INDEX_SIZE;
+    }
+    gCache.index[slot] = (int16_t)(row + 1);
+  }
+}
+
+static ifstats_row_t *find_row(const char *name)
+{
+  uint32_t slot = hash_name(name) % INDEX_SIZE;
+
+  while (gCache.index[slot] != 0)
+  {
+    ifstats_row_t *row = &gCache.rows[gCache.index[slot] - 1];
+
+    if (!strcmp(row->name, name))
+    {
+      return row;
+    }
+    slot = (slot + 1) % INDEX_SIZE;
+  }
+  return NULL;
+}
+
+/* Returns 1 when the row now names a different interface than before */
+static int store_row(int row, const char *name, uint64_t rxBytes, uint64_t rxPackets, uint64_t txBytes, uint64_t txPackets)
+{
+  int changed = 0;
+
+  if (strncmp(gCache.rows[row].name, name, IFNAMSIZ) != 0)
+  {
+    strncpy(gCache.rows[row].name, name, IFNAMSIZ - 1);
+    gCache.rows[row].name[IFNAMSIZ - 1] = '\0';
+    changed = 1;
+  }
+  gCache.rows[row].rxBytes = rxBytes;
+  gCache.rows[row].rxPackets = rxPackets;
+  gCache.rows[row].txBytes = txBytes;
+  gCache.rows[row].txPackets = txPackets;
+  return changed;
+}
+
+static void finish_rows(int rowCount, int changed)
+{
+  if (changed || rowCount != gCache.rowCount)
+  {
+    gCache.rowCount = rowCount;
+    rebuild_index();
+  }
+}
+
+static int grow_buffer(size_t size)
+{
+  char *buf;
+
+  if (gCache.bufSize >= size)
+  {
+    return 0;
+  }
+  buf = (char *)realloc(gCache.buf, size);
+  if (buf == NULL)
+  {
+    return -1;
+  }
+  gCache.buf = buf;
+  gCache.bufSize = size;
+  return 0;
+}
+
+/* Re-reads the whole file through the descriptor kept open since the first load */
+static ssize_t read_proc(void)
+{
+  size_t used = 0;
+  ssize_t n;
+
+  if (gCache.fd < 0)
+  {
+    gCache.fd = open(PROC_NET_DEV, O_RDONLY | O_CLOEXEC);
+    if (gCache.fd < 0)
+    {
+      return -1;
+    }
+  }
+  if (lseek(gCache.fd, 0, SEEK_SET) != 0)
+  {
+    return -1;
+  }
+  for (;;)
+  {
+    if (used + 1 >= gCache.bufSize && grow_buffer(gCache.bufSize ? gCache.bufSize * 2 : 4096) < 0)
+    {
+      return -1;
+    }
+    n = read(gCache.fd, gCache.buf + used, gCache.bufSize - used - 1);
+    if (n < 0)
+    {
+      return -1;
+    }
+    if (n == 0)
+    {
+      break;
+    }
+    used += (size_t)n;
+  }
+  gCache.buf[used] = '\0';
+  return (ssize_t)used;
+}
+
+/*
+ * Each data line is "<name>: rx_bytes rx_packets errs drop fifo frame compressed multicast
+ * tx_bytes tx_packets ...". Rows keep their position across refreshes, so the index only
+ * has to be rebuilt when an interface appears, disappears or is renamed.
+ */
+static INT parse_proc(void)
+{
+  char *line = gCache.buf;
+  int row = 0;
+  int changed = 0;
+  int skip = 2;
+
+  while (line != NULL && *line != '\0')
+  {
+    char *next = strchr(line, '\n');
+    char *colon;
+    char *name = line;
+    char *p;
+    uint64_t fields[10];
+    int i;
+
+    if (next != NULL)
+    {
+      *next++ = '\0';
+    }
+    if (skip > 0)
+    {
+      skip--;
+      line = next;
+      continue;
+    }
+    colon = strchr(line, ':');
+    if (colon == NULL || row >= MAX_ROWS)
+    {
+      line = next;
+      continue;
+    }
+    *colon = '\0';
+    while (*name == ' ')
+    {
+      name++;
+    }
+    p = colon + 1;
+    for (i = 0; i < 10; i++)
+    {
+      fields[i] = strtoull(p, &p, 10);
+    }
+    changed |= store_row(row, name, fields[0], fields[1], fields[8], fields[9]);
+    row++;
+    line = next;
+  }
+  finish_rows(row, changed);
+  return RETURN_OK;
+}
+
+static INT read_procfs(void)
+{
+  if (read_proc() < 0)
+  {
+    if (gCache.fd >= 0)
+    {
+      close(gCache.fd);
+      gCache.fd = -1;
+    }
+    return RETURN_ERR;
+  }
+  return parse_proc();
+}
+
+static void parse_link(struct nlmsghdr *nlh, int *row, int *changed)
+{
+  struct ifinfomsg *ifi = (struct ifinfomsg *)NLMSG_DATA(nlh);
+  struct rtattr *rta = IFLA_RTA(ifi);
+  int len = (int)IFLA_PAYLOAD(nlh);
+  const char *name = NULL;
+  struct rtnl_link_stats64 stats64;
+  struct rtnl_link_stats stats32;
+  int have64 = 0;
+  int have32 = 0;
+
+  for (; RTA_OK(rta, len); rta = RTA_NEXT(rta, len))
+  {
+    if (rta->rta_type == IFLA_IFNAME)
+    {
+      name = (const char *)RTA_DATA(rta);
+    }
+    else if (rta->rta_type == IFLA_STATS64 && RTA_PAYLOAD(rta) >= sizeof(stats64))
+    {
+      /* The payload is only 4 byte aligned, copy before reading 64 bit fields */
+      memcpy(&stats64, RTA_DATA(rta), sizeof(stats64));
+      have64 = 1;
+    }
+    else if (rta->rta_type == IFLA_STATS && RTA_PAYLOAD(rta) >= sizeof(stats32))
+    {
+      memcpy(&stats32, RTA_DATA(rta), sizeof(stats32));
+      have32 = 1;
+    }
+  }
+  if (name == NULL || (!have64 && !have32) || *row >= MAX_ROWS)
+  {
+    return;
+  }
+  if (have64)
+  {
+    *changed |= store_row(*row, name, stats64.rx_bytes, stats64.rx_packets, stats64.tx_bytes, stats64.tx_packets);
+  }
+  else
+  {
+    *changed |= store_row(*row, name, stats32.rx_bytes, stats32.rx_packets, stats32.tx_bytes, stats32.tx_packets);
+  }
+  (*row)++;
+}
+
+/*
+ * One RTM_GETLINK dump returns IFLA_STATS64 for every link, so a refresh costs a single
+ * request no matter how many bridge, GRE or VLAN interfaces the caller asks about.
+ */
+static INT read_netlink(void)
+{
+  struct
+  {
+    struct nlmsghdr  nlh;
+    struct ifinfomsg ifm;
+  } req;
+  struct sockaddr_nl kernel;
+  int row = 0;
+  int changed = 0;
+  int done = 0;
+
+  if (gCache.nlFd < 0)
+  {
+    gCache.nlFd = socket(AF_NETLINK, SOCK_RAW | SOCK_CLOEXEC, NETLINK_ROUTE);
+    if (gCache.nlFd < 0)
+    {
+      return RETURN_ERR;
+    }
+  }
+  if (grow_buffer(NETLINK_BUF_SIZE) < 0)
+  {
+    return RETURN_ERR;
+  }
+  memset(&req, 0, sizeof(req));
+  req.nlh.nlmsg_len = NLMSG_LENGTH(sizeof(struct ifinfomsg));
+  req.nlh.nlmsg_type = RTM_GETLINK;
+  req.nlh.nlmsg_flags = NLM_F_REQUEST | NLM_F_DUMP;
+  req.nlh.nlmsg_seq = ++gCache.nlSeq;
+  req.ifm.ifi_family = AF_UNSPEC;
+  memset(&kernel, 0, sizeof(kernel));
+  kernel.nl_family = AF_NETLINK;
+  if (sendto(gCache.nlFd, &req, req.nlh.nlmsg_len, 0, (struct sockaddr *)&kernel, sizeof(kernel)) < 0)
+  {
+    goto fail;
+  }
+  while (!done)
+  {
+    ssize_t n = recv(gCache.nlFd, gCache.buf, gCache.bufSize, 0);
+    struct nlmsghdr *nlh = (struct nlmsghdr *)gCache.buf;
+    int len = (int)n;
+
+    if (n < 0)
+    {
+      goto fail;
+    }
+    for (; NLMSG_OK(nlh, len); nlh = NLMSG_NEXT(nlh, len))
+    {
+      if (nlh->nlmsg_seq != gCache.nlSeq)
+      {
+        continue;
+      }
+      if (nlh->nlmsg_type == NLMSG_DONE)
+      {
+        done = 1;
+        break;
+      }
+      if (nlh->nlmsg_type == NLMSG_ERROR)
+      {
+        goto fail;
+      }
+      if (nlh->nlmsg_type == RTM_NEWLINK)
+      {
+        parse_link(nlh, &row, &changed);
+      }
+    }
+  }
+  finish_rows(row, changed);
+  return RETURN_OK;
+
+fail:
+  /* Drop the socket so a half read dump cannot leak into the next request */
+  close(gCache.nlFd);
+  gCache.nlFd = -1;
+  return RETURN_ERR;
+}
+
+static INT refresh_locked(void)
+{
+  uint64_t now = now_ms();
+  INT ret;
+
+  if (gCache.loadedAtMs != 0 && now - gCache.loadedAtMs < gCache.freshnessMs)
+  {
+    return RETURN_OK;
+  }
+  ret = (gCache.provider == SKELETON_IFSTATS_NETLINK) ? read_netlink() : read_procfs();
+  gCache.loadedAtMs = (ret == RETURN_OK) ? (now ? now : 1) : 0;
+  return ret;
+}
+
+static INT lookup_locked(const char *ifname, PINTF_STATS pIntfStats)
+{
+  ifstats_row_t *row;
+
+  if (ifname == NULL || pIntfStats == NULL || ifname[0] == '\0' || strlen(ifname) >= IFNAMSIZ)
+  {
+    return RETURN_ERR;
+  }
+  row = find_row(ifname);
+  if (row == NULL)
+  {
+    return RETURN_ERR;
+  }
+  memset(pIntfStats, 0, sizeof(INTF_STATS));
+  pIntfStats->rx_bytes = row->rxBytes;
+  pIntfStats->rx_packet = row->rxPackets;
+  pIntfStats->tx_bytes = row->txBytes;
+  pIntfStats->tx_packet = row->txPackets;
+  return RETURN_OK;
+}
+
+void skeleton_ifstats_configure(skeleton_ifstats_provider_t provider, uint64_t freshnessMs)
+{
+  pthread_once(&gIfstatsOnce, load_settings);
+  pthread_mutex_lock(&gCache.lock);
+  gCache.provider = provider;
+  gCache.freshnessMs = freshnessMs;
+  gCache.loadedAtMs = 0;
+  pthread_mutex_unlock(&gCache.lock);
+}
+
+INT skeleton_ifstats_get(const char *ifname, PINTF_STATS pIntfStats)
+{
+  INT ret = RETURN_ERR;
+
+  if (ifname == NULL || pIntfStats == NULL || ifname[0] == '\0' || strlen(ifname) >= IFNAMSIZ)
+  {
+    return RETURN_ERR;
+  }
+  pthread_once(&gIfstatsOnce, load_settings);
+  pthread_mutex_lock(&gCache.lock);
+  if (refresh_locked() == RETURN_OK)
+  {
+    ret = lookup_locked(ifname, pIntfStats);
+  }
+  pthread_mutex_unlock(&gCache.lock);
+  return ret;
+}
+
+INT skeleton_ifstats_get_bulk(const char * const *ifnames, INTF_STATS *pIntfStats, INT *pStatus, int count)
+{
+  INT ret = RETURN_OK;
+  int i;
+
+  if (ifnames == NULL || pIntfStats == NULL || count < 0)
+  {
+    return RETURN_ERR;
+  }
+  pthread_once(&gIfstatsOnce, load_settings);
+  pthread_mutex_lock(&gCache.lock);
+  if (refresh_locked() != RETURN_OK)
+  {
+    pthread_mutex_unlock(&gCache.lock);
+    return RETURN_ERR;
+  }
+  for (i = 0; i < count; i++)
+  {
+    INT status = lookup_locked(ifnames[i], &pIntfStats[i]);
+
+    if (status != RETURN_OK)
+    {
+      memset(&pIntfStats[i], 0, sizeof(INTF_STATS));
+      ret = RETURN_ERR;
+    }
+    if (pStatus != NULL)
+    {
+      pStatus[i] = status;
+    }
+  }
+  pthread_mutex_unlock(&gCache.lock);
+  return ret;
+}
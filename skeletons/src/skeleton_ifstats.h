@@ -0,0 +1,78 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+* @file skeleton_ifstats.h
+* @brief Host interface counters for platform_hal_GetInterfaceStats on the Linux skeleton.
+*
+* One snapshot of the host counters is shared by every caller for "freshness_ms" milliseconds
+* (section "InterfaceStats" of the skeleton config, default 500). The snapshot comes from
+* /proc/net/dev ("provider": "procfs", the default) or from a single RTM_GETLINK netlink
+* dump reading IFLA_STATS64 ("provider": "netlink"). Descriptors and buffers are kept
+* between refreshes, counters are updated in place while the set of interfaces is
+* unchanged, and a name to row hash index makes each lookup O(1).
+*/
+
+#ifndef __SKELETON_IFSTATS_H__
+#define __SKELETON_IFSTATS_H__
+
+#include <stdint.h>
+#include "platform_hal.h"
+
+/**
+* @brief Source of the interface counters.
+*/
+typedef enum
+{
+  SKELETON_IFSTATS_PROCFS = 0,   /**< Text parse of /proc/net/dev */
+  SKELETON_IFSTATS_NETLINK       /**< RTM_GETLINK dump with IFLA_STATS64 */
+} skeleton_ifstats_provider_t;
+
+/**
+* @brief Override the provider and freshness window read from the skeleton config.
+*
+* The next lookup always refreshes the snapshot. Used by the skeleton benchmarks.
+*
+* @param[in] provider    - Source of the counters
+* @param[in] freshnessMs - Age in milliseconds up to which a snapshot is reused, 0 to refresh on every call
+*/
+void skeleton_ifstats_configure(skeleton_ifstats_provider_t provider, uint64_t freshnessMs);
+
+/**
+* @brief Return the counters of one host interface.
+*
+* @param[in]  ifname     - Interface name as listed in /proc/net/dev
+* @param[out] pIntfStats - Counters of the interface
+*
+* @return RETURN_OK on success, RETURN_ERR for a NULL, empty or unknown interface
+*/
+INT skeleton_ifstats_get(const char *ifname, PINTF_STATS pIntfStats);
+
+/**
+* @brief Return the counters of several host interfaces from one snapshot.
+*
+* @param[in]  ifnames    - Interface names
+* @param[out] pIntfStats - Array of count entries; unknown interfaces are zeroed
+* @param[out] pStatus    - Optional array of count per interface results, may be NULL
+* @param[in]  count      - Number of interfaces
+*
+* @return RETURN_OK when every interface was found, RETURN_ERR otherwise
+*/
+INT skeleton_ifstats_get_bulk(const char * const *ifnames, INTF_STATS *pIntfStats, INT *pStatus, int count);
+
+#endif /* __SKELETON_IFSTATS_H__ */
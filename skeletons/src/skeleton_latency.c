@@ -0,0 +1,286 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include <string.h>
+#include <stdio.h>
+#include <math.h>
+#include <errno.h>
+#include <time.h>
+#include <pthread.h>
+#include "skeleton_clock.h"
+#include "skeleton_config.h"
+#include "skeleton_latency.h"
+
+#define API_PREFIX        "platform_hal_"
+#define MAX_PROFILES      (128)
+#define MAX_API_NAME      (64)
+#define TWO_PI            (6.283185307179586)
+
+typedef enum
+{
+  LATENCY_NONE = 0,
+  LATENCY_FIXED,
+  LATENCY_UNIFORM,
+  LATENCY_LOGNORMAL,
+  LATENCY_BIMODAL
+} latency_dist_t;
+
+typedef struct
+{
+  char           name[MAX_API_NAME];
+  latency_dist_t dist;
+  double         a;              /* fixed: us, uniform: min_us, lognormal: log(median_us) */
+  double         b;              /* uniform: max_us, lognormal: sigma */
+  double         tailMu;
+  double         tailSigma;
+  double         tailProbability;
+  uint64_t       blockUs;
+  uint64_t       maxTimeoutUs;
+  int            honourTimeout;
+} latency_profile_t;
+
+static pthread_once_t gLatencyOnce = PTHREAD_ONCE_INIT;
+static latency_profile_t gProfiles[MAX_PROFILES];
+static latency_profile_t gDefault;
+static int gEnabled = 0;
+static uint64_t gSeed = 0x9E3779B97F4A7C15ULL;
+static uint64_t gThreadCount = 0;
+
+static __thread uint64_t tRandState = 0;
+
+static const char *short_name(const char *api)
+{
+  if (!strncmp(api, API_PREFIX, sizeof(API_PREFIX) - 1))
+  {
+    return api + sizeof(API_PREFIX) - 1;
+  }
+  return api;
+}
+
+static uint32_t hash_name(const char *name)
+{
+  uint32_t hash = 2166136261u;
+
+  while (*name != '\0')
+  {
+    hash = (hash ^ (uint8_t)*name++) * 16777619u;
+  }
+  return hash;
+}
+
+static latency_profile_t *find_slot(const char *name)
+{
+  uint32_t i = hash_name(name) % MAX_PROFILES;
+  uint32_t probes;
+
+  for (probes = 0; probes < MAX_PROFILES; probes++)
+  {
+    if (gProfiles[i].name[0] == '\0' || !strcmp(gProfiles[i].name, name))
+    {
+      return &gProfiles[i];
+    }
+    i = (i + 1) % MAX_PROFILES;
+  }
+  return NULL;
+}
+
+static int parse_profile(const cJSON *item, latency_profile_t *profile)
+{
+  const char *dist = skeleton_config_string(item, "distribution", "fixed");
+  double median;
+
+  if (!cJSON_IsObject(item))
+  {
+    return -1;
+  }
+  if (!strcmp(dist, "fixed"))
+  {
+    profile->dist = LATENCY_FIXED;
+    profile->a = skeleton_config_number(item, "us", 0);
+  }
+  else if (!strcmp(dist, "uniform"))
+  {
+    profile->dist = LATENCY_UNIFORM;
+    profile->a = skeleton_config_number(item, "min_us", 0);
+    profile->b = skeleton_config_number(item, "max_us", profile->a);
+    if (profile->b < profile->a)
+    {
+      return -1;
+    }
+  }
+  else if (!strcmp(dist, "lognormal") || !strcmp(dist, "bimodal"))
+  {
+    profile->dist = !strcmp(dist, "lognormal") ? LATENCY_LOGNORMAL : LATENCY_BIMODAL;
+    median = skeleton_config_number(item, "median_us", 1);
+    profile->a = log(median > 0 ? median : 1);
+    profile->b = skeleton_config_number(item, "sigma", 0.25);
+    if (profile->dist == LATENCY_BIMODAL)
+    {
+      median = skeleton_config_number(item, "tail_median_us", 100 * exp(profile->a));
+      profile->tailMu = log(median > 0 ? median : 1);
+      profile->tailSigma = skeleton_config_number(item, "tail_sigma", profile->b);
+      profile->tailProbability = skeleton_config_number(item, "tail_probability", 0.01);
+    }
+  }
+  else
+  {
+    return -1;
+  }
+  profile->blockUs = (uint64_t)(skeleton_config_number(item, "block_ms", 0) * 1000);
+  profile->honourTimeout = !strcmp(skeleton_config_string(item, "block", "none"), "timeout");
+  profile->maxTimeoutUs = (uint64_t)(skeleton_config_number(item, "max_block_ms", 60000) * 1000);
+  return 0;
+}
+
+static void load_profiles(void)
+{
+  const cJSON *section = skeleton_config_section("Latency");
+  const cJSON *item;
+
+  if (section == NULL)
+  {
+    return;
+  }
+  gSeed ^= (uint64_t)skeleton_config_number(section, "seed", 0);
+  cJSON_ArrayForEach(item, section)
+  {
+    latency_profile_t profile;
+    latency_profile_t *slot;
+    const char *name;
+
+    if (item->string == NULL || !strcmp(item->string, "seed"))
+    {
+      continue;
+    }
+    memset(&profile, 0, sizeof(profile));
+    if (parse_profile(item, &profile) != 0)
+    {
+      printf("skeleton: ignoring invalid latency profile '%s'\n", item->string);
+      continue;
+    }
+    if (!strcmp(item->string, "default"))
+    {
+      gDefault = profile;
+      gEnabled = 1;
+      continue;
+    }
+    name = short_name(item->string);
+    slot = find_slot(name);
+    if (slot == NULL || strlen(name) >= MAX_API_NAME)
+    {
+      continue;
+    }
+    profile.dist = (profile.dist == LATENCY_NONE) ? LATENCY_FIXED : profile.dist;
+    snprintf(profile.name, sizeof(profile.name), "%s", name);
+    *slot = profile;
+    gEnabled = 1;
+  }
+}
+
+/* splitmix64, seeded per thread so runs with the same seed are repeatable per thread */
+static uint64_t next_random(void)
+{
+  uint64_t z;
+
+  if (tRandState == 0)
+  {
+    tRandState = gSeed + __atomic_add_fetch(&gThreadCount, 1, __ATOMIC_RELAXED) * 0xBF58476D1CE4E5B9ULL;
+  }
+  z = (tRandState += 0x9E3779B97F4A7C15ULL);
+  z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+  z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+  return z ^ (z >> 31);
+}
+
+static double next_uniform(void)
+{
+  return (double)(next_random() >> 11) * (1.0 / 9007199254740992.0);
+}
+
+static double next_normal(void)
+{
+  double u1 = next_uniform();
+  double u2 = next_uniform();
+
+  if (u1 <= 0.0)
+  {
+    u1 = 1.0 / 9007199254740992.0;
+  }
+  return sqrt(-2.0 * log(u1)) * cos(TWO_PI * u2);
+}
+
+static double sample_us(const latency_profile_t *profile)
+{
+  switch (profile->dist)
+  {
+    case LATENCY_FIXED:
+      return profile->a;
+    case LATENCY_UNIFORM:
+      return profile->a + (profile->b - profile->a) * next_uniform();
+    case LATENCY_LOGNORMAL:
+      return exp(profile->a + profile->b * next_normal());
+    case LATENCY_BIMODAL:
+      if (next_uniform() < profile->tailProbability)
+      {
+        return exp(profile->tailMu + profile->tailSigma * next_normal());
+      }
+      return exp(profile->a + profile->b * next_normal());
+    default:
+      return 0;
+  }
+}
+
+void skeleton_latency_sleep_us(uint64_t us)
+{
+  struct timespec ts;
+
+  ts.tv_sec = (time_t)(us / 1000000);
+  ts.tv_nsec = (long)((us % 1000000) * 1000);
+  while (nanosleep(&ts, &ts) != 0 && errno == EINTR)
+  {
+  }
+}
+
+void skeleton_latency_inject(const char *api, uint64_t timeoutMs)
+{
+  const latency_profile_t *profile;
+  uint64_t delayUs;
+
+  pthread_once(&gLatencyOnce, load_profiles);
+  if (!gEnabled)
+  {
+    return;
+  }
+  profile = find_slot(short_name(api));
+  if (profile == NULL || profile->name[0] == '\0')
+  {
+    profile = &gDefault;
+  }
+  delayUs = (uint64_t)sample_us(profile) + profile->blockUs;
+  if (delayUs > 0)
+  {
+    skeleton_latency_sleep_us(delayUs);
+  }
+  if (profile->honourTimeout)
+  {
+    /* The timeout is waited out on the virtual clock, like the deadlines it stands for */
+    uint64_t timeoutUs = timeoutMs * 1000;
+
+    skeleton_clock_wait(((timeoutUs < profile->maxTimeoutUs) ? timeoutUs : profile->maxTimeoutUs) / 1000);
+  }
+}
@@ -0,0 +1,64 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+* @file skeleton_latency.h
+* @brief Per-API latency and blocking injection for the Linux skeleton HAL.
+*
+* Profiles are read from the "Latency" section of the skeleton config. Each key is an API
+* name, with or without the "platform_hal_" prefix, plus the optional "default" and "seed"
+* keys:
+*
+* | distribution | parameters                                                         |
+* | ------------ | ------------------------------------------------------------------ |
+* | fixed        | us                                                                 |
+* | uniform      | min_us, max_us                                                     |
+* | lognormal    | median_us, sigma                                                   |
+* | bimodal      | median_us, sigma, tail_median_us, tail_sigma, tail_probability     |
+*
+* Blocking behaviour is layered on top of the sampled delay:
+* - "block_ms" stalls every call for a fixed time (e.g. a slow DocsisParamsDBInit).
+* - "block": "timeout" makes APIs that take a timeout argument (StartMACsec) wait it out,
+*   capped by "max_block_ms". That wait runs on the virtual clock (skeleton_clock.h), so
+*   it follows the clock scale and ends early when a test advances the clock.
+*
+* With no config every call returns immediately.
+*/
+
+#ifndef __SKELETON_LATENCY_H__
+#define __SKELETON_LATENCY_H__
+
+#include <stdint.h>
+
+/**
+* @brief Delay the calling thread according to the profile configured for an API.
+*
+* @param[in] api       - API name, normally __func__
+* @param[in] timeoutMs - Timeout argument of the API in milliseconds, or 0 if it has none
+*/
+void skeleton_latency_inject(const char *api, uint64_t timeoutMs);
+
+/**
+* @brief Sleep for a number of microseconds, restarting on signals.
+*/
+void skeleton_latency_sleep_us(uint64_t us);
+
+#define SKELETON_LATENCY()                  skeleton_latency_inject(__func__, 0)
+#define SKELETON_LATENCY_TIMEOUT(timeoutMs) skeleton_latency_inject(__func__, (timeoutMs))
+
+#endif /* __SKELETON_LATENCY_H__ */
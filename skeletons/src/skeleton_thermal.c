@@ -0,0 +1,320 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+#include <math.h>
+#include <string.h>
+#include <pthread.h>
+#include "skeleton_config.h"
+#include "skeleton_clock.h"
+#include "skeleton_thermal.h"
+
+#define STEP_MS          (250)
+#define MAX_FAILURES     (8)
+#define TWO_PI           (6.283185307179586)
+
+typedef struct
+{
+  unsigned int         fan;
+  uint64_t             atMs;
+  skeleton_fan_fault_t fault;
+  double               rpmFactor;
+  int                  applied;
+} scheduled_failure_t;
+
+typedef struct
+{
+  pthread_mutex_t      lock;
+  int                  enabled;
+  int                  primed;
+  int                  reportInput;
+  double               ambientC;
+  double               initialC;
+  int                  haveInitial;
+  double               loadW;
+  double               swingW;
+  double               periodS;
+  double               supplyV;
+  double               capacitance;
+  double               passiveG;
+  double               fanG;
+  double               maxRpm;
+  double               spinupS;
+  double               radioOffsetC[SKELETON_THERMAL_MAX_RADIOS];
+  double               tempC;
+  double               targetRpm[SKELETON_THERMAL_MAX_FANS];
+  double               rpm[SKELETON_THERMAL_MAX_FANS];
+  skeleton_fan_fault_t fault[SKELETON_THERMAL_MAX_FANS];
+  double               rpmFactor[SKELETON_THERMAL_MAX_FANS];
+  uint64_t             startMs;
+  uint64_t             lastMs;
+  int                  failureCount;
+  scheduled_failure_t  failures[MAX_FAILURES];
+} thermal_plant_t;
+
+static thermal_plant_t gPlant =
+{
+  .lock = PTHREAD_MUTEX_INITIALIZER,
+};
+
+static pthread_once_t gThermalOnce = PTHREAD_ONCE_INIT;
+
+static skeleton_fan_fault_t parse_fault(const char *mode)
+{
+  if (!strcmp(mode, "stall"))
+  {
+    return SKELETON_FAN_STALL;
+  }
+  if (!strcmp(mode, "degraded"))
+  {
+    return SKELETON_FAN_DEGRADED;
+  }
+  return SKELETON_FAN_OK;
+}
+
+static void load_failures(const cJSON *list)
+{
+  int i;
+
+  for (i = 0; cJSON_IsArray(list) && i < cJSON_GetArraySize(list) && gPlant.failureCount < MAX_FAILURES; i++)
+  {
+    const cJSON *item = cJSON_GetArrayItem(list, i);
+    scheduled_failure_t *failure = &gPlant.failures[gPlant.failureCount];
+    double fan = skeleton_config_number(item, "fan", -1);
+
+    if (fan < 0 || fan >= SKELETON_THERMAL_MAX_FANS)
+    {
+      continue;
+    }
+    failure->fan = (unsigned int)fan;
+    failure->atMs = (uint64_t)(skeleton_config_number(item, "at_s", 0) * 1000);
+    failure->fault = parse_fault(skeleton_config_string(item, "mode", "stall"));
+    failure->rpmFactor = skeleton_config_number(item, "rpm_factor", 0.5);
+    gPlant.failureCount++;
+  }
+}
+
+static void load_plant(void)
+{
+  const cJSON *section = skeleton_config_section("Thermal");
+  const cJSON *offsets = cJSON_GetObjectItem(section, "radio_offset_c");
+  int i;
+
+  gPlant.enabled = skeleton_config_bool(section, "enabled", 0);
+  gPlant.reportInput = skeleton_config_bool(section, "report_input", 1);
+  gPlant.ambientC = skeleton_config_number(section, "ambient_c", 25);
+  gPlant.haveInitial = (cJSON_GetObjectItem(section, "initial_c") != NULL);
+  gPlant.initialC = skeleton_config_number(section, "initial_c", gPlant.ambientC);
+  gPlant.loadW = skeleton_config_number(section, "load_w", 14.4);
+  gPlant.swingW = skeleton_config_number(section, "load_swing_w", 0);
+  gPlant.periodS = skeleton_config_number(section, "load_period_s", 600);
+  gPlant.supplyV = skeleton_config_number(section, "supply_v", 12);
+  gPlant.capacitance = skeleton_config_number(section, "capacitance_j_per_c", 600);
+  gPlant.passiveG = skeleton_config_number(section, "passive_w_per_c", 0.15);
+  gPlant.fanG = skeleton_config_number(section, "fan_w_per_c", 0.5);
+  gPlant.maxRpm = skeleton_config_number(section, "max_rpm", 6000);
+  gPlant.spinupS = skeleton_config_number(section, "spinup_s", 3);
+  for (i = 0; i < SKELETON_THERMAL_MAX_RADIOS; i++)
+  {
+    const cJSON *offset = cJSON_IsArray(offsets) ? cJSON_GetArrayItem(offsets, i) : NULL;
+
+    gPlant.radioOffsetC[i] = cJSON_IsNumber(offset) ? cJSON_GetNumberValue(offset) : 5.0 * (i + 1);
+  }
+  for (i = 0; i < SKELETON_THERMAL_MAX_FANS; i++)
+  {
+    gPlant.rpmFactor[i] = 1.0;
+  }
+  load_failures(cJSON_GetObjectItem(section, "fan_failures"));
+  /* Guard the divisions of the model against nonsensical configs */
+  if (gPlant.capacitance <= 0)
+  {
+    gPlant.capacitance = 1;
+  }
+  if (gPlant.passiveG <= 0)
+  {
+    gPlant.passiveG = 0.001;
+  }
+  if (gPlant.maxRpm <= 0)
+  {
+    gPlant.maxRpm = 1;
+  }
+  if (gPlant.supplyV <= 0)
+  {
+    gPlant.supplyV = 12;
+  }
+}
+
+static double load_at(uint64_t ms)
+{
+  double t = (double)(ms - gPlant.startMs) / 1000.0;
+
+  if (gPlant.swingW == 0 || gPlant.periodS <= 0)
+  {
+    return gPlant.loadW;
+  }
+  return gPlant.loadW + gPlant.swingW * sin(TWO_PI * t / gPlant.periodS);
+}
+
+static double effective_target(unsigned int fan)
+{
+  switch (gPlant.fault[fan])
+  {
+    case SKELETON_FAN_STALL:
+      return 0;
+    case SKELETON_FAN_DEGRADED:
+      return gPlant.targetRpm[fan] * gPlant.rpmFactor[fan];
+    default:
+      return gPlant.targetRpm[fan];
+  }
+}
+
+static double conductance(void)
+{
+  double g = gPlant.passiveG;
+  int i;
+
+  for (i = 0; i < SKELETON_THERMAL_MAX_FANS; i++)
+  {
+    g += gPlant.fanG * gPlant.rpm[i] / gPlant.maxRpm;
+  }
+  return g;
+}
+
+static void prime_locked(void)
+{
+  uint64_t now = skeleton_clock_now_ms();
+
+  if (gPlant.primed)
+  {
+    return;
+  }
+  gPlant.primed = 1;
+  gPlant.startMs = now;
+  gPlant.lastMs = now;
+  gPlant.tempC = gPlant.haveInitial ? gPlant.initialC : gPlant.ambientC + load_at(now) / conductance();
+}
+
+static void apply_failures(uint64_t ms)
+{
+  int i;
+
+  for (i = 0; i < gPlant.failureCount; i++)
+  {
+    scheduled_failure_t *failure = &gPlant.failures[i];
+
+    if (!failure->applied && ms - gPlant.startMs >= failure->atMs)
+    {
+      gPlant.fault[failure->fan] = failure->fault;
+      gPlant.rpmFactor[failure->fan] = failure->rpmFactor;
+      failure->applied = 1;
+    }
+  }
+}
+
+/*
+ * Each step holds the load and the fan speeds constant and uses the exact exponential
+ * solution of the first order equations, so large steps stay stable at any time scale.
+ */
+static void advance_locked(uint64_t now)
+{
+  while (gPlant.lastMs < now)
+  {
+    uint64_t stepMs = (now - gPlant.lastMs < STEP_MS) ? now - gPlant.lastMs : STEP_MS;
+    double dt = (double)stepMs / 1000.0;
+    double g;
+    double steadyC;
+    int i;
+
+    apply_failures(gPlant.lastMs);
+    for (i = 0; i < SKELETON_THERMAL_MAX_FANS; i++)
+    {
+      double target = effective_target(i);
+
+      gPlant.rpm[i] = (gPlant.spinupS > 0) ? target + (gPlant.rpm[i] - target) * exp(-dt / gPlant.spinupS) : target;
+    }
+    g = conductance();
+    steadyC = gPlant.ambientC + load_at(gPlant.lastMs + stepMs / 2) / g;
+    gPlant.tempC = steadyC + (gPlant.tempC - steadyC) * exp(-g * dt / gPlant.capacitance);
+    gPlant.lastMs += stepMs;
+  }
+  apply_failures(gPlant.lastMs);
+}
+
+int skeleton_thermal_enabled(void)
+{
+  pthread_once(&gThermalOnce, load_plant);
+  return gPlant.enabled;
+}
+
+void skeleton_thermal_set_fan(unsigned int fanIndex, unsigned int rpm)
+{
+  pthread_once(&gThermalOnce, load_plant);
+  if (fanIndex >= SKELETON_THERMAL_MAX_FANS)
+  {
+    return;
+  }
+  pthread_mutex_lock(&gPlant.lock);
+  if (gPlant.primed)
+  {
+    advance_locked(skeleton_clock_now_ms());
+  }
+  else
+  {
+    gPlant.rpm[fanIndex] = rpm;
+  }
+  gPlant.targetRpm[fanIndex] = rpm;
+  pthread_mutex_unlock(&gPlant.lock);
+}
+
+void skeleton_thermal_fail_fan(unsigned int fanIndex, skeleton_fan_fault_t fault, double rpmFactor)
+{
+  pthread_once(&gThermalOnce, load_plant);
+  if (fanIndex >= SKELETON_THERMAL_MAX_FANS)
+  {
+    return;
+  }
+  pthread_mutex_lock(&gPlant.lock);
+  prime_locked();
+  advance_locked(skeleton_clock_now_ms());
+  gPlant.fault[fanIndex] = fault;
+  gPlant.rpmFactor[fanIndex] = rpmFactor;
+  pthread_mutex_unlock(&gPlant.lock);
+}
+
+void skeleton_thermal_read(skeleton_thermal_reading_t *reading)
+{
+  int i;
+
+  pthread_once(&gThermalOnce, load_plant);
+  pthread_mutex_lock(&gPlant.lock);
+  prime_locked();
+  advance_locked(skeleton_clock_now_ms());
+  reading->tempC = gPlant.tempC;
+  for (i = 0; i < SKELETON_THERMAL_MAX_RADIOS; i++)
+  {
+    reading->radioC[i] = gPlant.tempC + gPlant.radioOffsetC[i];
+  }
+  reading->loadW = load_at(gPlant.lastMs);
+  reading->currentMa = reading->loadW / gPlant.supplyV * 1000.0;
+  reading->reportInput = gPlant.reportInput;
+  for (i = 0; i < SKELETON_THERMAL_MAX_FANS; i++)
+  {
+    reading->rpm[i] = gPlant.rpm[i];
+    reading->rotorLock[i] = (gPlant.fault[i] == SKELETON_FAN_STALL && gPlant.targetRpm[i] > 0) ? 1 : 0;
+  }
+  pthread_mutex_unlock(&gPlant.lock);
+}
@@ -0,0 +1,111 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+* @file skeleton_thermal.h
+* @brief Closed loop thermal plant behind the fan and temperature APIs of the Linux skeleton HAL.
+*
+* The board is modelled as one thermal mass heated by the input load and cooled through a
+* passive path plus a path proportional to the speed of each fan:
+*
+*   C * dT/dt = P(t) - (T - T_ambient) * (G_passive + G_fan * sum(rpm_i / max_rpm))
+*
+* Fans follow their commanded speed with a first order spin up lag, can be failed (stalled
+* or degraded) from the config or at run time, and every reading integrates the model up
+* to the current time of the virtual clock (see skeleton_clock.h). The plant is enabled by
+* the "Thermal" section of the skeleton config:
+*
+* | key                  | default | meaning                                                |
+* | -------------------- | ------- | ------------------------------------------------------ |
+* | enabled              | false   | Use the plant instead of constant readings             |
+* | ambient_c            | 25      | Ambient temperature                                    |
+* | initial_c            | steady  | Start temperature, steady state for the start speeds   |
+* | load_w               | 14.4    | Mean heat load                                         |
+* | load_swing_w         | 0       | Amplitude of a sinusoidal load variation               |
+* | load_period_s        | 600     | Period of the load variation                           |
+* | report_input         | true    | Report the load through getInputPower/getInputCurrent  |
+* | supply_v             | 12      | Supply voltage used to derive the input current        |
+* | capacitance_j_per_c  | 600     | Thermal capacitance of the board                       |
+* | passive_w_per_c      | 0.15    | Conductance to ambient with the fans stopped           |
+* | fan_w_per_c          | 0.5     | Additional conductance per fan at max_rpm              |
+* | max_rpm              | 6000    | Fan speed at which fan_w_per_c is reached              |
+* | spinup_s             | 3       | Time constant of the fan speed response                |
+* | radio_offset_c       | 5,10,15 | Radio temperatures above the board, per radio          |
+* | fan_failures         | none    | List of { fan, at_s, mode: stall or degraded, rpm_factor } |
+*/
+
+#ifndef __SKELETON_THERMAL_H__
+#define __SKELETON_THERMAL_H__
+
+#define SKELETON_THERMAL_MAX_FANS   (2)
+#define SKELETON_THERMAL_MAX_RADIOS (3)
+
+/**
+* @brief Fan failure modes.
+*/
+typedef enum
+{
+  SKELETON_FAN_OK = 0,     /**< Fan follows its commanded speed */
+  SKELETON_FAN_STALL,      /**< Rotor locked, the fan stops */
+  SKELETON_FAN_DEGRADED    /**< Fan reaches only a fraction of its commanded speed */
+} skeleton_fan_fault_t;
+
+/**
+* @brief State of the plant at the current virtual time.
+*/
+typedef struct
+{
+  double tempC;                                 /**< Board temperature */
+  double radioC[SKELETON_THERMAL_MAX_RADIOS];   /**< Radio temperatures */
+  double loadW;                                 /**< Heat load */
+  double currentMa;                             /**< Input current drawn for the load */
+  int    reportInput;                           /**< Non zero when the input APIs report the load */
+  double rpm[SKELETON_THERMAL_MAX_FANS];        /**< Measured fan speeds */
+  int    rotorLock[SKELETON_THERMAL_MAX_FANS];  /**< 1 when a driven fan is stalled */
+} skeleton_thermal_reading_t;
+
+/**
+* @brief Return non zero when the "Thermal" section enables the plant.
+*/
+int skeleton_thermal_enabled(void);
+
+/**
+* @brief Command the speed of a fan.
+*
+* Commands issued before the first reading also set the fan speed the plant starts with.
+*
+* @param[in] fanIndex - Fan index, below SKELETON_THERMAL_MAX_FANS
+* @param[in] rpm      - Commanded speed
+*/
+void skeleton_thermal_set_fan(unsigned int fanIndex, unsigned int rpm);
+
+/**
+* @brief Integrate the plant up to the current virtual time and return its state.
+*/
+void skeleton_thermal_read(skeleton_thermal_reading_t *reading);
+
+/**
+* @brief Fail or repair a fan from now on.
+*
+* @param[in] fanIndex  - Fan index, below SKELETON_THERMAL_MAX_FANS
+* @param[in] fault     - Failure mode, SKELETON_FAN_OK repairs the fan
+* @param[in] rpmFactor - Fraction of the commanded speed reached in SKELETON_FAN_DEGRADED mode
+*/
+void skeleton_thermal_fail_fan(unsigned int fanIndex, skeleton_fan_fault_t fault, double rpmFactor);
+
+#endif /* __SKELETON_THERMAL_H__ */
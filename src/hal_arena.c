@@ -0,0 +1,285 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+* @file hal_arena.c
+* @brief Per test arena, see hal_arena.h.
+*/
+
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#ifdef HAL_ARENA_GUARD
+#include <signal.h>
+#include <sys/mman.h>
+#endif
+#include "hal_fixture.h"
+#include "hal_arena.h"
+
+#define ALIGN_UP(x, a) (((x) + (a) - 1) & ~((size_t)(a) - 1))
+
+static char gLock = 0;
+
+static void arena_lock(void)
+{
+    while (__atomic_test_and_set(&gLock, __ATOMIC_ACQUIRE))
+    {
+    }
+}
+
+static void arena_unlock(void)
+{
+    __atomic_clear(&gLock, __ATOMIC_RELEASE);
+}
+
+#ifndef HAL_ARENA_GUARD
+
+/* Chunks stay on the list across resets; only those made for an oversized allocation are freed */
+typedef struct hal_arena_chunk
+{
+    struct hal_arena_chunk *next;
+    size_t                  capacity;
+    size_t                  used;
+} hal_arena_chunk_t;
+
+#define CHUNK_HEADER   ALIGN_UP(sizeof(hal_arena_chunk_t), HAL_ARENA_ALIGNMENT)
+#define CHUNK_CAPACITY (HAL_ARENA_CHUNK_SIZE - CHUNK_HEADER)
+
+static hal_arena_chunk_t *gHead = NULL;
+static hal_arena_chunk_t *gCurrent = NULL;
+
+void *hal_arena_alloc(size_t size)
+{
+    hal_arena_chunk_t *chunk;
+    hal_arena_chunk_t **link;
+    void *memory = NULL;
+
+    size = ALIGN_UP(size ? size : 1, HAL_ARENA_ALIGNMENT);
+    arena_lock();
+    for (chunk = gCurrent; chunk != NULL && chunk->capacity - chunk->used < size; chunk = chunk->next)
+    {
+    }
+    if (chunk == NULL)
+    {
+        size_t capacity = (size > CHUNK_CAPACITY) ? size : CHUNK_CAPACITY;
+
+        if (posix_memalign(&memory, HAL_ARENA_ALIGNMENT, CHUNK_HEADER + capacity) != 0)
+        {
+            arena_unlock();
+            return NULL;
+        }
+        chunk = memory;
+        chunk->next = NULL;
+        chunk->capacity = capacity;
+        chunk->used = 0;
+        for (link = &gHead; *link != NULL; link = &(*link)->next)
+        {
+        }
+        *link = chunk;
+    }
+    gCurrent = chunk;
+    memory = (char *)chunk + CHUNK_HEADER + chunk->used;
+    chunk->used += size;
+    arena_unlock();
+
+    memset(memory, 0, size);
+    return memory;
+}
+
+void hal_arena_reset(void)
+{
+    hal_arena_chunk_t **link = &gHead;
+    hal_arena_chunk_t *chunk;
+
+    arena_lock();
+    while ((chunk = *link) != NULL)
+    {
+        if (chunk->capacity > CHUNK_CAPACITY)
+        {
+            *link = chunk->next;
+            free(chunk);
+            continue;
+        }
+        chunk->used = 0;
+        link = &chunk->next;
+    }
+    gCurrent = gHead;
+    arena_unlock();
+}
+
+static void arena_release(void)
+{
+    hal_arena_chunk_t *chunk;
+
+    hal_arena_reset();
+    while ((chunk = gHead) != NULL)
+    {
+        gHead = chunk->next;
+        free(chunk);
+    }
+    gCurrent = NULL;
+}
+
+static int arena_guard_init(void)
+{
+    return 0;
+}
+
+#else /* HAL_ARENA_GUARD */
+
+/* Each allocation is a mapping of its own: this header, the object ending on a page boundary, then the guard page */
+typedef struct hal_arena_guard
+{
+    struct hal_arena_guard *next;
+    size_t                  length;    /**< Length of the whole mapping */
+    char                   *object;
+    size_t                  size;      /**< Size asked for by the test */
+    const char             *test;
+} hal_arena_guard_t;
+
+static hal_arena_guard_t *gGuards = NULL;
+static size_t gPageSize = 0;
+static struct sigaction gPreviousAction;
+
+void *hal_arena_alloc(size_t size)
+{
+    size_t span = ALIGN_UP(size ? size : 1, HAL_ARENA_ALIGNMENT);
+    size_t data = ALIGN_UP(sizeof(hal_arena_guard_t) + span, gPageSize);
+    hal_arena_guard_t *guard;
+    char *base;
+
+    base = mmap(NULL, data + gPageSize, PROT_READ | PROT_WRITE, MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+    if (base == MAP_FAILED)
+    {
+        return NULL;
+    }
+    if (mprotect(base + data, gPageSize, PROT_NONE) != 0)
+    {
+        munmap(base, data + gPageSize);
+        return NULL;
+    }
+    guard = (hal_arena_guard_t *)base;
+    guard->length = data + gPageSize;
+    guard->object = base + data - span;
+    guard->size = size;
+    guard->test = hal_fixture_current();
+
+    arena_lock();
+    guard->next = gGuards;
+    gGuards = guard;
+    arena_unlock();
+
+    /* Fresh anonymous mappings are already zeroed */
+    return guard->object;
+}
+
+void hal_arena_reset(void)
+{
+    hal_arena_guard_t *guard;
+
+    arena_lock();
+    guard = gGuards;
+    gGuards = NULL;
+    arena_unlock();
+
+    while (guard != NULL)
+    {
+        hal_arena_guard_t *next = guard->next;
+
+        munmap(guard, guard->length);
+        guard = next;
+    }
+}
+
+static void arena_release(void)
+{
+    hal_arena_reset();
+}
+
+static void arena_fault(int signal, siginfo_t *info, void *context)
+{
+    const char *address = info->si_addr;
+    hal_arena_guard_t *guard;
+    char message[256];
+    int length;
+
+    (void)signal;
+    (void)context;
+    for (guard = gGuards; guard != NULL; guard = guard->next)
+    {
+        const char *end = (const char *)guard + guard->length;
+
+        if (address >= end - gPageSize && address < end)
+        {
+            length = snprintf(message, sizeof(message),
+                              "hal_arena: %s wrote %zu bytes past the end of a %zu byte arena allocation at %p\n",
+                              guard->test ? guard->test : "setup", (size_t)(address - guard->object) - guard->size,
+                              guard->size, (void *)guard->object);
+            if (length > 0)
+            {
+                (void)!write(STDERR_FILENO, message, (size_t)length < sizeof(message) ? (size_t)length : sizeof(message) - 1);
+            }
+            break;
+        }
+    }
+    /* Returning retries the faulting store under the previous disposition */
+    sigaction(SIGSEGV, &gPreviousAction, NULL);
+}
+
+static int arena_guard_init(void)
+{
+    struct sigaction action;
+
+    gPageSize = (size_t)sysconf(_SC_PAGESIZE);
+    memset(&action, 0, sizeof(action));
+    action.sa_sigaction = arena_fault;
+    action.sa_flags = SA_SIGINFO;
+    sigemptyset(&action.sa_mask);
+    return sigaction(SIGSEGV, &action, &gPreviousAction);
+}
+
+#endif /* HAL_ARENA_GUARD */
+
+static void arena_after_test(const char *test)
+{
+    (void)test;
+    hal_arena_reset();
+}
+
+static const hal_fixture_hook_t gArenaHook =
+{
+    .name = "arena",
+    .before = NULL,
+    .after = arena_after_test,
+};
+
+int hal_arena_init(void)
+{
+    if (arena_guard_init() != 0)
+    {
+        return -1;
+    }
+    if (hal_fixture_register(&gArenaHook) != 0)
+    {
+        return -1;
+    }
+    atexit(arena_release);
+    return 0;
+}
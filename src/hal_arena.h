@@ -0,0 +1,63 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+* @file hal_arena.h
+* @brief Per test arena for the structures the tests pass to the HAL.
+*
+* hal_arena_alloc() hands out zeroed memory that stays valid until the end of the running
+* test, when the fixture hook registered by hal_arena_init() releases all of it at once.
+* Tests therefore never free what they take from the arena, and a test that fails half way
+* through cannot leak it. By default the arena is a bump allocator over 64 KiB chunks that
+* are kept from one test to the next, so repeated and soak runs do not touch the heap.
+*
+* Built with "make ARENA_GUARD=1" (HAL_ARENA_GUARD) every allocation gets its own mapping,
+* placed so that it ends against an inaccessible guard page. A HAL writing past the end of
+* an output structure then faults at the offending store, and the SIGSEGV handler reports
+* the test and allocation before the default action terminates the run. Allocations are
+* aligned to 16 bytes, so an overrun of less than the alignment padding goes unnoticed.
+*/
+
+#ifndef __HAL_ARENA_H__
+#define __HAL_ARENA_H__
+
+#include <stddef.h>
+
+#define HAL_ARENA_CHUNK_SIZE (64 * 1024)
+#define HAL_ARENA_ALIGNMENT  (16)
+
+/**
+* @brief Register the arena reset with the per test hooks. Must be called before the tests start.
+*
+* @return 0 on success, -1 on failure
+*/
+int hal_arena_init(void);
+
+/**
+* @brief Allocate zeroed memory that lives until the end of the running test.
+*
+* @return The memory, or NULL if it cannot be allocated
+*/
+void *hal_arena_alloc(size_t size);
+
+/**
+* @brief Release everything allocated since the last reset. Called after every test.
+*/
+void hal_arena_reset(void);
+
+#endif /* __HAL_ARENA_H__ */
@@ -0,0 +1,684 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+* @file hal_case.c
+* @brief Interpreter of the table driven tests, see hal_case.h.
+*/
+
+#include <ut.h>
+#include <ut_log.h>
+#include <limits.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <unistd.h>
+#include "hal_arena.h"
+#include "hal_case.h"
+#include "hal_fixture.h"
+#include "hal_mac.h"
+#include "hal_log.h"
+
+#define DESCRIPTION_SIZE  (256)
+#define BOUNDARY_MAX      (6)
+#define BUFFER_REF_OFFSET (16)
+#define FILE_PATH_SIZE    (64)
+#define FILE_TEMPLATE     "/tmp/platform_hal_case_XXXXXX"
+
+typedef struct
+{
+    long long value;
+    void     *ptr;
+} hal_case_value_t;
+
+typedef long long (*hal_case_invoke_t)(const hal_case_value_t *v);
+
+/*
+ * One invoker per API of hal_api.def. Each parameter is passed from the value or the ptr
+ * member of its slot, chosen by its HAL_ARG_* descriptor, and converted implicitly to the
+ * parameter type.
+ */
+#undef HAL_ARG_VALUE
+#undef HAL_ARG_STR_IN
+#undef HAL_ARG_MEM_IN
+#undef HAL_ARG_STR_OUT
+#undef HAL_ARG_MEM_OUT
+#undef HAL_ARG_MEM_OUT_REF
+#undef HAL_ARG_DHCP_OUT
+#undef HAL_NO_ARGS
+
+#define HAL_ARG_VALUE(x)              CASE_VALUE
+#define HAL_ARG_STR_IN(p)             CASE_PTR
+#define HAL_ARG_MEM_IN(p, type)       CASE_PTR
+#define HAL_ARG_STR_OUT(p)            CASE_PTR
+#define HAL_ARG_MEM_OUT(p, type)      CASE_PTR
+#define HAL_ARG_MEM_OUT_REF(pp, type) CASE_PTR
+#define HAL_ARG_DHCP_OUT(pp)          CASE_PTR
+#define HAL_NO_ARGS                   CASE_NONE
+
+#define CASE_VALUE(i) v[i].value
+#define CASE_PTR(i)   v[i].ptr
+#define CASE_NONE(i)
+
+#define CASE_ARG(i, d)       d(i)
+#define CASE_ARGS_1(a)       CASE_ARG(0, a)
+#define CASE_ARGS_2(a, b)    CASE_ARG(0, a), CASE_ARG(1, b)
+#define CASE_ARGS_3(a, b, c) CASE_ARG(0, a), CASE_ARG(1, b), CASE_ARG(2, c)
+#define CASE_COUNT(...)      CASE_COUNT_(__VA_ARGS__, 3, 2, 1)
+#define CASE_COUNT_(a, b, c, n, ...) n
+#define CASE_CAT(a, b)       CASE_CAT_(a, b)
+#define CASE_CAT_(a, b)      a##b
+#define CASE_ARGS(...)       CASE_CAT(CASE_ARGS_, CASE_COUNT(__VA_ARGS__))(__VA_ARGS__)
+
+#define HAL_API(kind, type, name, params, forward, ...) \
+    static long long invoke_##name(const hal_case_value_t *v) \
+    { \
+        (void)v; \
+        return (long long)platform_hal_##name(CASE_ARGS(__VA_ARGS__)); \
+    }
+#include "hal_api.def"
+#undef HAL_API
+
+#undef HAL_ARG_VALUE
+#undef HAL_ARG_STR_IN
+#undef HAL_ARG_MEM_IN
+#undef HAL_ARG_STR_OUT
+#undef HAL_ARG_MEM_OUT
+#undef HAL_ARG_MEM_OUT_REF
+#undef HAL_ARG_DHCP_OUT
+#undef HAL_NO_ARGS
+
+/* The same descriptors, now giving the kind of each parameter */
+#define HAL_ARG_VALUE(x)              HAL_ARG_KIND_VALUE
+#define HAL_ARG_STR_IN(p)             HAL_ARG_KIND_STR_IN
+#define HAL_ARG_MEM_IN(p, type)       HAL_ARG_KIND_MEM_IN
+#define HAL_ARG_STR_OUT(p)            HAL_ARG_KIND_STR_OUT
+#define HAL_ARG_MEM_OUT(p, type)      HAL_ARG_KIND_MEM_OUT
+#define HAL_ARG_MEM_OUT_REF(pp, type) HAL_ARG_KIND_MEM_OUT_REF
+#define HAL_ARG_DHCP_OUT(pp)          HAL_ARG_KIND_DHCP_OUT
+#define HAL_NO_ARGS                   HAL_ARG_KIND_NONE
+
+static const struct
+{
+    const char       *name;
+    hal_ret_kind_t    retKind;
+    hal_case_invoke_t invoke;
+    hal_arg_kind_t    kinds[HAL_CASE_MAX_ARGS];
+} gApis[HAL_API_COUNT] =
+{
+#define HAL_API(kind, type, name, params, forward, ...) { #name, kind, invoke_##name, { __VA_ARGS__ } },
+#include "hal_api.def"
+#undef HAL_API
+};
+
+/* Boundary values of the range low to high in ascending order, limited to int */
+static size_t boundary_values(const hal_gen_t *gen, long long *values)
+{
+    const long long candidates[BOUNDARY_MAX] =
+    {
+        INT_MIN, gen->low - 1, gen->low, gen->high, gen->high + 1, INT_MAX
+    };
+    size_t count = 0;
+    size_t i;
+
+    for (i = 0; i < BOUNDARY_MAX; i++)
+    {
+        if (candidates[i] >= INT_MIN && candidates[i] <= INT_MAX &&
+            (count == 0 || candidates[i] > values[count - 1]))
+        {
+            values[count++] = candidates[i];
+        }
+    }
+    return count;
+}
+
+/* Number of values a generator produces, 0 if it has none to offer */
+static size_t generator_count(const hal_gen_t *gen)
+{
+    long long boundary[BOUNDARY_MAX];
+
+    switch (gen->kind)
+    {
+        case HAL_GEN_KIND_BOUNDARY:
+            return boundary_values(gen, boundary);
+        case HAL_GEN_KIND_RANGE:
+            return (gen->high >= gen->low) ? (size_t)(gen->high - gen->low + 1) : 0;
+        case HAL_GEN_KIND_VALUES:
+            return gen->count;
+        case HAL_GEN_KIND_ARRAY:
+            return (*(int *const *)gen->variable != NULL && *gen->length > 0) ? (size_t)*gen->length : 0;
+        default:
+            return 1;
+    }
+}
+
+static long long generator_value(const hal_gen_t *gen, size_t index)
+{
+    long long boundary[BOUNDARY_MAX];
+
+    switch (gen->kind)
+    {
+        case HAL_GEN_KIND_BOUNDARY:
+            boundary_values(gen, boundary);
+            return boundary[index];
+        case HAL_GEN_KIND_RANGE:
+            return gen->low + (long long)index;
+        case HAL_GEN_KIND_VALUES:
+            return gen->values[index];
+        case HAL_GEN_KIND_VARIABLE:
+            return *(const int *)gen->variable + gen->low;
+        case HAL_GEN_KIND_ARRAY:
+            return (*(int *const *)gen->variable)[index];
+        default:
+            return 0;
+    }
+}
+
+static void store_integer(void *ptr, size_t size, long long value)
+{
+    switch (size)
+    {
+        case 1: *(unsigned char *)ptr = (unsigned char)value; break;
+        case 2: *(unsigned short *)ptr = (unsigned short)value; break;
+        case 4: *(unsigned int *)ptr = (unsigned int)value; break;
+        default: *(unsigned long long *)ptr = (unsigned long long)value; break;
+    }
+}
+
+static long long load_integer(const void *ptr, size_t size, int isSigned)
+{
+    switch (size)
+    {
+        case 1: return isSigned ? (long long)*(const signed char *)ptr : (long long)*(const unsigned char *)ptr;
+        case 2: return isSigned ? (long long)*(const short *)ptr : (long long)*(const unsigned short *)ptr;
+        case 4: return isSigned ? (long long)*(const int *)ptr : (long long)*(const unsigned int *)ptr;
+        default: return *(const long long *)ptr;
+    }
+}
+
+/* Value indexes of a combination number, the last parameter varying fastest */
+static void decode(size_t combination, int argCount, const size_t *count, size_t *index)
+{
+    int i;
+
+    for (i = argCount - 1; i >= 0; i--)
+    {
+        index[i] = combination % count[i];
+        combination /= count[i];
+    }
+}
+
+/* Whether a combination has a boundary value outside its valid range */
+static int negative(const hal_case_t *test, int argCount, const size_t *index)
+{
+    const hal_gen_t *gen;
+    long long value;
+    int i;
+
+    for (i = 0; i < argCount; i++)
+    {
+        gen = &test->args[i];
+        if (gen->kind == HAL_GEN_KIND_BOUNDARY)
+        {
+            value = generator_value(gen, index[i]);
+            if (value < gen->low || value > gen->high)
+            {
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+/*
+ * Greedy pairwise covering of the negative combinations: take the one covering the most
+ * pairs not yet covered until no pair is left. A parameter paired with itself stands for
+ * its single values, so rows with one varying parameter are covered as well.
+ */
+static int select_pairwise(const hal_case_t *test, int argCount, const size_t *count, size_t total,
+                           size_t *selected, size_t *runs)
+{
+    size_t offset[HAL_CASE_MAX_ARGS][HAL_CASE_MAX_ARGS];
+    size_t index[HAL_CASE_MAX_ARGS];
+    size_t pairs = 0;
+    size_t best = 0;
+    size_t bestGain;
+    size_t gain;
+    size_t pair;
+    size_t c;
+    unsigned char *needed;
+    unsigned char *covered;
+    unsigned char *used;
+    int i;
+    int j;
+
+    for (i = 0; i < argCount; i++)
+    {
+        for (j = i; j < argCount; j++)
+        {
+            offset[i][j] = pairs;
+            pairs += (i == j) ? count[i] : count[i] * count[j];
+        }
+    }
+    needed = hal_arena_alloc(2 * pairs + total);
+    if (needed == NULL)
+    {
+        return -1;
+    }
+    covered = needed + pairs;
+    used = covered + pairs;
+
+#define PAIR(i, j) (offset[i][j] + ((i) == (j) ? index[i] : index[i] * count[j] + index[j]))
+    for (c = 0; c < total; c++)
+    {
+        decode(c, argCount, count, index);
+        if (!negative(test, argCount, index))
+        {
+            used[c] = 1;
+            continue;
+        }
+        for (i = 0; i < argCount; i++)
+        {
+            for (j = i; j < argCount; j++)
+            {
+                needed[PAIR(i, j)] = 1;
+            }
+        }
+    }
+
+    *runs = 0;
+    for (;;)
+    {
+        bestGain = 0;
+        for (c = 0; c < total; c++)
+        {
+            if (used[c])
+            {
+                continue;
+            }
+            decode(c, argCount, count, index);
+            gain = 0;
+            for (i = 0; i < argCount; i++)
+            {
+                for (j = i; j < argCount; j++)
+                {
+                    pair = PAIR(i, j);
+                    gain += needed[pair] && !covered[pair];
+                }
+            }
+            if (gain > bestGain)
+            {
+                bestGain = gain;
+                best = c;
+            }
+        }
+        if (bestGain == 0)
+        {
+            break;
+        }
+        used[best] = 1;
+        selected[(*runs)++] = best;
+        decode(best, argCount, count, index);
+        for (i = 0; i < argCount; i++)
+        {
+            for (j = i; j < argCount; j++)
+            {
+                covered[PAIR(i, j)] = 1;
+            }
+        }
+    }
+#undef PAIR
+    return 0;
+}
+
+/* Write the bytes of a FILE generator to a new temporary file, named in path */
+static int write_file(char *path, const hal_gen_t *gen)
+{
+    int fd;
+
+    snprintf(path, FILE_PATH_SIZE, "%s", FILE_TEMPLATE);
+    fd = mkstemp(path);
+    if (fd < 0)
+    {
+        return -1;
+    }
+    if (write(fd, gen->string, gen->count) != (ssize_t)gen->count)
+    {
+        close(fd);
+        unlink(path);
+        return -1;
+    }
+    close(fd);
+    return 0;
+}
+
+/* Remove the temporary files of a combination once the call returned */
+static void remove_files(const hal_case_t *test, int argCount, const hal_case_value_t *values)
+{
+    int i;
+
+    for (i = 0; i < argCount; i++)
+    {
+        if (test->args[i].kind == HAL_GEN_KIND_FILE)
+        {
+            unlink(values[i].ptr);
+        }
+    }
+}
+
+/* Set the parameters of one combination and describe them for the log */
+static int prepare(const hal_case_t *test, int argCount, const size_t *index, hal_case_value_t *values, char *description)
+{
+    size_t used = 0;
+    int i;
+
+    description[0] = '\0';
+    for (i = 0; i < argCount; i++)
+    {
+        const hal_gen_t *gen = &test->args[i];
+        size_t room = DESCRIPTION_SIZE - used;
+        int length = 0;
+
+        switch (gen->kind)
+        {
+            case HAL_GEN_KIND_NULL:
+                length = snprintf(description + used, room, "%sNULL", i ? ", " : "");
+                break;
+            case HAL_GEN_KIND_BUFFER:
+                memset(values[i].ptr, 0, gen->size);
+                length = snprintf(description + used, room, "%sbuffer[%zu]", i ? ", " : "", gen->size);
+                break;
+            case HAL_GEN_KIND_STRING:
+                memcpy(values[i].ptr, gen->string, gen->size);
+                length = snprintf(description + used, room, "%s\"%s\"", i ? ", " : "", gen->string);
+                break;
+            case HAL_GEN_KIND_REF:
+                store_integer(values[i].ptr, gen->size, gen->low);
+                length = snprintf(description + used, room, "%s&%lld", i ? ", " : "", gen->low);
+                break;
+            case HAL_GEN_KIND_BUFFER_REF:
+                /* The buffer follows the pointer to it, at the arena alignment */
+                memset((char *)values[i].ptr + BUFFER_REF_OFFSET, 0, gen->size);
+                *(void **)values[i].ptr = (char *)values[i].ptr + BUFFER_REF_OFFSET;
+                length = snprintf(description + used, room, "%s&buffer[%zu]", i ? ", " : "", gen->size);
+                break;
+            case HAL_GEN_KIND_BYTES:
+                memset(values[i].ptr, 0, gen->size);
+                memcpy(values[i].ptr, gen->string, (gen->count < gen->size) ? gen->count : gen->size);
+                length = snprintf(description + used, room, "%sbytes[%zu]", i ? ", " : "", gen->count);
+                break;
+            case HAL_GEN_KIND_FILE:
+                if (write_file(values[i].ptr, gen) != 0)
+                {
+                    HAL_LOG_ERROR("%s: cannot create a file for parameter %d", test->name, i + 1);
+                    remove_files(test, i, values);
+                    return -1;
+                }
+                length = snprintf(description + used, room, "%s%s[%zu]", i ? ", " : "", (char *)values[i].ptr, gen->count);
+                break;
+            default:
+                values[i].value = generator_value(gen, index[i]);
+                length = snprintf(description + used, room, "%s%lld", i ? ", " : "", values[i].value);
+                break;
+        }
+        if (length > 0)
+        {
+            used += ((size_t)length < room) ? (size_t)length : room - 1;
+        }
+    }
+    return 0;
+}
+
+/* Log the outputs of a successful call */
+static void log_outputs(const hal_case_t *test, int argCount, const hal_case_value_t *values)
+{
+    const hal_arg_kind_t *kinds = gApis[test->api].kinds;
+    int i;
+
+    for (i = 0; i < argCount; i++)
+    {
+        const hal_gen_t *gen = &test->args[i];
+
+        if (kinds[i] == HAL_ARG_KIND_STR_OUT && gen->kind == HAL_GEN_KIND_BUFFER)
+        {
+            UT_LOG("Output parameter %d : %.*s", i + 1, (int)gen->size, (const char *)values[i].ptr);
+        }
+        else if (kinds[i] == HAL_ARG_KIND_MEM_OUT && gen->kind == HAL_GEN_KIND_REF)
+        {
+            UT_LOG("Output parameter %d : %lld", i + 1, load_integer(values[i].ptr, gen->size, gen->isSigned));
+        }
+    }
+}
+
+/* Validate the checked output of a successful call */
+static int validate(const hal_case_t *test, const hal_case_value_t *values)
+{
+    const hal_check_t *check = &test->check;
+    const hal_gen_t *gen = &test->args[check->arg];
+    const char *string = values[check->arg].ptr;
+    long long number;
+    int i;
+
+    if (check->kind != HAL_CHECK_KIND_RANGE && check->kind != HAL_CHECK_KIND_NONE &&
+        memchr(string, '\0', gen->size) == NULL)
+    {
+        HAL_LOG_ERROR("%s: output parameter %d is not terminated", test->name, check->arg + 1);
+        return 0;
+    }
+    switch (check->kind)
+    {
+        case HAL_CHECK_KIND_RANGE:
+            number = load_integer(values[check->arg].ptr, gen->size, gen->isSigned);
+            return number >= check->low && number <= check->high;
+        case HAL_CHECK_KIND_NUMBER:
+            number = atoll(string);
+            return number >= check->low && number <= check->high;
+        case HAL_CHECK_KIND_STRINGS:
+            for (i = 0; i < HAL_CASE_MAX_STRINGS && check->strings[i] != NULL; i++)
+            {
+                if (!strcmp(string, check->strings[i]))
+                {
+                    return 1;
+                }
+            }
+            return 0;
+        case HAL_CHECK_KIND_MAC:
+            return hal_mac_valid(string);
+        default:
+            return 1;
+    }
+}
+
+/*
+ * Call the API with every selected combination of the case, logging each call unless quiet.
+ * Returns the number of calls that did not give the expected, valid result, or -1 when the
+ * arguments could not be set up.
+ */
+static long run_calls(const hal_case_t *test, int quiet, size_t *calls)
+{
+    hal_case_value_t values[HAL_CASE_MAX_ARGS];
+    size_t index[HAL_CASE_MAX_ARGS];
+    size_t count[HAL_CASE_MAX_ARGS];
+    char description[DESCRIPTION_SIZE];
+    const char *api = gApis[test->api].name;
+    size_t *selected = NULL;
+    size_t total = 1;
+    size_t runs;
+    size_t run;
+    long failures = 0;
+    long long result;
+    int pairwise = 0;
+    int argCount = 0;
+
+    *calls = 0;
+    memset(values, 0, sizeof(values));
+    while (argCount < HAL_CASE_MAX_ARGS && test->args[argCount].kind != HAL_GEN_KIND_NONE)
+    {
+        const hal_gen_t *gen = &test->args[argCount];
+        size_t size = gen->size;
+
+        count[argCount] = generator_count(gen);
+        if (count[argCount] == 0)
+        {
+            /* e.g. no FanIndex in the platform config, as a loop over it would do nothing */
+            if (!quiet)
+            {
+                UT_LOG("%s: no values configured for parameter %d, nothing to run", test->name, argCount + 1);
+            }
+            return 0;
+        }
+        total *= count[argCount];
+        pairwise |= (gen->kind == HAL_GEN_KIND_BOUNDARY);
+        if (gen->kind == HAL_GEN_KIND_BUFFER_REF)
+        {
+            size += BUFFER_REF_OFFSET;
+        }
+        else if (gen->kind == HAL_GEN_KIND_FILE)
+        {
+            size = FILE_PATH_SIZE;
+        }
+        if (gen->kind == HAL_GEN_KIND_BUFFER || gen->kind == HAL_GEN_KIND_STRING ||
+            gen->kind == HAL_GEN_KIND_REF || gen->kind == HAL_GEN_KIND_BUFFER_REF ||
+            gen->kind == HAL_GEN_KIND_BYTES || gen->kind == HAL_GEN_KIND_FILE)
+        {
+            values[argCount].ptr = hal_arena_alloc(size);
+            if (values[argCount].ptr == NULL)
+            {
+                HAL_LOG_ERROR("Arena allocation failed");
+                return -1;
+            }
+        }
+        argCount++;
+    }
+
+    runs = total;
+    if (pairwise)
+    {
+        if (total > HAL_CASE_MAX_PAIRWISE)
+        {
+            HAL_LOG_ERROR("%s: %zu combinations, a negative matrix takes at most %d", test->name, total, HAL_CASE_MAX_PAIRWISE);
+            return -1;
+        }
+        selected = hal_arena_alloc(total * sizeof(size_t));
+        if (selected == NULL || select_pairwise(test, argCount, count, total, selected, &runs) != 0)
+        {
+            HAL_LOG_ERROR("Arena allocation failed");
+            return -1;
+        }
+        if (!quiet)
+        {
+            UT_LOG("%s: %zu of %zu combinations cover every pair of negative values", test->name, runs, total);
+        }
+    }
+
+    for (run = 0; run < runs; run++)
+    {
+        decode(pairwise ? selected[run] : run, argCount, count, index);
+        if (prepare(test, argCount, index, values, description) != 0)
+        {
+            return -1;
+        }
+        if (!quiet)
+        {
+            HAL_LOG_DEBUG("Invoking platform_hal_%s(%s)", api, description);
+        }
+        result = gApis[test->api].invoke(values);
+        remove_files(test, argCount, values);
+        if (!quiet)
+        {
+            UT_LOG("platform_hal_%s(%s) returns : %lld", api, description, result);
+        }
+        if (result != test->expect)
+        {
+            if (!quiet)
+            {
+                HAL_LOG_ERROR("platform_hal_%s(%s) returned %lld, expected %lld", api, description, result, test->expect);
+            }
+            failures++;
+        }
+        else if (gApis[test->api].retKind == HAL_RET_STATUS && result == RETURN_OK)
+        {
+            if (!quiet)
+            {
+                log_outputs(test, argCount, values);
+            }
+            if (!validate(test, values))
+            {
+                if (!quiet)
+                {
+                    HAL_LOG_ERROR("platform_hal_%s(%s) returned an invalid output", api, description);
+                }
+                failures++;
+            }
+        }
+    }
+    *calls = runs;
+    return failures;
+}
+
+static void run_case(const void *context)
+{
+    const hal_case_t *test = context;
+    size_t calls;
+    long failures;
+
+    HAL_LOG_DEBUG("Entering %s...", test->name);
+    failures = run_calls(test, 0, &calls);
+    if (failures < 0)
+    {
+        UT_FAIL("Table driven test could not be set up");
+    }
+    else if (failures != 0)
+    {
+        UT_FAIL("Table driven test failed");
+    }
+    else
+    {
+        HAL_LOG_TRACE("%s: %zu calls validated", test->name, calls);
+        UT_PASS("Table driven test validation success");
+    }
+    HAL_LOG_DEBUG("Exiting %s...", test->name);
+}
+
+long hal_case_call(const hal_case_t *test, size_t *calls)
+{
+    return run_calls(test, 1, calls);
+}
+
+const char *hal_case_api_name(hal_api_id_t api)
+{
+    return (api < HAL_API_COUNT) ? gApis[api].name : NULL;
+}
+
+int hal_case_register(UT_test_suite_t *suite, const hal_case_t *cases, size_t count)
+{
+    UT_TestFunction function;
+    size_t i;
+
+    for (i = 0; i < count; i++)
+    {
+        function = hal_fixture_wrap_data(cases[i].name, run_case, &cases[i]);
+        if (function == NULL)
+        {
+            printf("hal_case: no trampoline left for %s\n", cases[i].name);
+            return -1;
+        }
+        (UT_add_test)(suite, cases[i].name, function);
+    }
+    return 0;
+}
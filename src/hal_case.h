@@ -0,0 +1,181 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+* @file hal_case.h
+* @brief Table driven tests: descriptors and the interpreter that runs them.
+*
+* A test that only calls one API with fixed or generated arguments and checks the result is
+* described by a row instead of a function. Rows are written in a .def file, one per test:
+*
+*     HAL_CASE(name, api, expect, check, generators...)
+*
+* name       - Test name without the suite prefix, e.g. negative1_GetModelName
+* api        - API name without the platform_hal_ prefix, as listed in hal_api.def
+* expect     - Expected result: RETURN_OK or RETURN_ERR, or the value for value APIs
+* check      - HAL_CHECK_* validation of an output when the call succeeds
+* generators - One HAL_GEN_* per API parameter, in order
+*
+* The including file defines HAL_CASE to expand the rows into an array of hal_case_t, so the
+* C preprocessor generates the tables and each test costs a few dozen bytes of read-only
+* data instead of a function. Generators can produce several values. The interpreter then
+* calls the API once for every combination of values within the one test, so covering a
+* range or a list of values costs a single row.
+*
+* A row with a HAL_GEN_BOUNDARY or HAL_GEN_ENUM generator is a negative matrix instead. Those
+* generators give the boundary values of a valid range, taken from the enumerators of the
+* HAL header: the first and last valid values, their outside neighbours and the int limits.
+* Only combinations with at least one value outside its range are run, and of these only a
+* pairwise covering subset: every pair of values of two parameters that can appear in such a
+* combination appears in one of the calls. The row expects the same result for all of them,
+* normally RETURN_ERR.
+*
+* HAL_GEN_BYTES and HAL_GEN_FILE replay raw inputs, such as the reproducers of the fuzz
+* targets: the bytes of a string literal, embedded NULs included, as the start of a structure
+* or as the contents of a file whose path is passed.
+*/
+
+#ifndef __HAL_CASE_H__
+#define __HAL_CASE_H__
+
+#include <stddef.h>
+#include <ut.h>
+#include "hal_interpose.h"
+
+#define HAL_CASE_MAX_ARGS     (4)
+#define HAL_CASE_MAX_STRINGS  (8)
+#define HAL_CASE_MAX_PAIRWISE (4096)  /**< Largest cross product a negative matrix selects from */
+
+/**
+* @brief How a generator produces the values of a parameter.
+*/
+typedef enum
+{
+    HAL_GEN_KIND_NONE = 0,     /**< Unused parameter slot */
+    HAL_GEN_KIND_RANGE,        /**< Every integer from low to high */
+    HAL_GEN_KIND_VALUES,       /**< Every integer of a list */
+    HAL_GEN_KIND_VARIABLE,     /**< An int variable plus low, read when the test runs */
+    HAL_GEN_KIND_ARRAY,        /**< Every element of an int array whose pointer and count are variables */
+    HAL_GEN_KIND_NULL,         /**< A NULL pointer */
+    HAL_GEN_KIND_BUFFER,       /**< A zeroed buffer of size bytes */
+    HAL_GEN_KIND_STRING,       /**< A writable copy of a string */
+    HAL_GEN_KIND_REF,          /**< A pointer to an integer of size bytes holding low */
+    HAL_GEN_KIND_BOUNDARY,     /**< Boundary values of the valid range low to high */
+    HAL_GEN_KIND_BUFFER_REF,   /**< A pointer to a pointer to a zeroed buffer of size bytes */
+    HAL_GEN_KIND_BYTES,        /**< An object of size bytes starting with the count bytes of string, zero after */
+    HAL_GEN_KIND_FILE          /**< The path of a temporary file holding the count bytes of string */
+} hal_gen_kind_t;
+
+/**
+* @brief Generator of the values of one parameter.
+*/
+typedef struct
+{
+    hal_gen_kind_t   kind;
+    long long        low;
+    long long        high;
+    const long long *values;
+    size_t           count;      /**< Number of values, or of bytes for the BYTES and FILE kinds */
+    size_t           size;       /**< Size of the object for the pointer kinds */
+    int              isSigned;   /**< Signedness of the REF integer */
+    const void      *variable;   /**< Variable of the VARIABLE and ARRAY kinds */
+    const int       *length;     /**< Element count of the ARRAY kind */
+    const char      *string;
+} hal_gen_t;
+
+#define HAL_GEN_VALUE(v)             { HAL_GEN_KIND_RANGE, (long long)(v), (long long)(v), NULL, 0, 0, 0, NULL, NULL, NULL }
+#define HAL_GEN_RANGE(lo, hi)        { HAL_GEN_KIND_RANGE, (long long)(lo), (long long)(hi), NULL, 0, 0, 0, NULL, NULL, NULL }
+#define HAL_GEN_VALUES(...)          { HAL_GEN_KIND_VALUES, 0, 0, (const long long[]){ __VA_ARGS__ }, \
+                                       sizeof((const long long[]){ __VA_ARGS__ }) / sizeof(long long), 0, 0, NULL, NULL, NULL }
+#define HAL_GEN_VARIABLE(var, add)   { HAL_GEN_KIND_VARIABLE, (long long)(add), 0, NULL, 0, 0, 0, &(var), NULL, NULL }
+#define HAL_GEN_ARRAY(array, count)  { HAL_GEN_KIND_ARRAY, 0, 0, NULL, 0, 0, 0, &(array), &(count), NULL }
+#define HAL_GEN_NULL                 { HAL_GEN_KIND_NULL, 0, 0, NULL, 0, 0, 0, NULL, NULL, NULL }
+#define HAL_GEN_BUFFER(bytes)        { HAL_GEN_KIND_BUFFER, 0, 0, NULL, 0, (bytes), 0, NULL, NULL, NULL }
+#define HAL_GEN_STRING(s)            { HAL_GEN_KIND_STRING, 0, 0, NULL, 0, sizeof(s), 0, NULL, NULL, (s) }
+#define HAL_GEN_REF(type, v)         { HAL_GEN_KIND_REF, (long long)(v), 0, NULL, 0, sizeof(type), ((type)-1 < (type)1), NULL, NULL, NULL }
+#define HAL_GEN_BOUNDARY(lo, hi)     { HAL_GEN_KIND_BOUNDARY, (long long)(lo), (long long)(hi), NULL, 0, 0, 0, NULL, NULL, NULL }
+#define HAL_GEN_ENUM(first, last)    HAL_GEN_BOUNDARY(first, last)
+#define HAL_GEN_BUFFER_REF(bytes)    { HAL_GEN_KIND_BUFFER_REF, 0, 0, NULL, 0, (bytes), 0, NULL, NULL, NULL }
+#define HAL_GEN_BYTES(type, s)       { HAL_GEN_KIND_BYTES, 0, 0, NULL, sizeof(s) - 1, sizeof(type), 0, NULL, NULL, (s) }
+#define HAL_GEN_FILE(s)              { HAL_GEN_KIND_FILE, 0, 0, NULL, sizeof(s) - 1, 0, 0, NULL, NULL, (s) }
+
+/**
+* @brief Validation of an output after a successful call.
+*/
+typedef enum
+{
+    HAL_CHECK_KIND_NONE = 0,
+    HAL_CHECK_KIND_RANGE,      /**< The REF integer is within low and high */
+    HAL_CHECK_KIND_NUMBER,     /**< The string holds a number within low and high */
+    HAL_CHECK_KIND_STRINGS,    /**< The string is one of strings */
+    HAL_CHECK_KIND_MAC         /**< The string is a MAC address */
+} hal_check_kind_t;
+
+typedef struct
+{
+    hal_check_kind_t kind;
+    int              arg;      /**< Index of the checked parameter */
+    long long        low;
+    long long        high;
+    const char      *strings[HAL_CASE_MAX_STRINGS];
+} hal_check_t;
+
+#define HAL_CHECK_NONE                 { HAL_CHECK_KIND_NONE, 0, 0, 0, { NULL } }
+#define HAL_CHECK_EQUAL(arg, v)        { HAL_CHECK_KIND_RANGE, (arg), (long long)(v), (long long)(v), { NULL } }
+#define HAL_CHECK_RANGE(arg, lo, hi)   { HAL_CHECK_KIND_RANGE, (arg), (long long)(lo), (long long)(hi), { NULL } }
+#define HAL_CHECK_NUMBER(arg, lo, hi)  { HAL_CHECK_KIND_NUMBER, (arg), (long long)(lo), (long long)(hi), { NULL } }
+#define HAL_CHECK_STRINGS(arg, ...)    { HAL_CHECK_KIND_STRINGS, (arg), 0, 0, { __VA_ARGS__ } }
+#define HAL_CHECK_MAC(arg)             { HAL_CHECK_KIND_MAC, (arg), 0, 0, { NULL } }
+
+/**
+* @brief One table driven test.
+*/
+typedef struct
+{
+    const char  *name;
+    hal_api_id_t api;
+    long long    expect;
+    hal_check_t  check;
+    hal_gen_t    args[HAL_CASE_MAX_ARGS];
+} hal_case_t;
+
+/**
+* @brief Register every case of a table with a suite, in table order.
+*
+* @return 0 on success, -1 if a case could not be registered
+*/
+int hal_case_register(UT_test_suite_t *suite, const hal_case_t *cases, size_t count);
+
+/**
+* @brief Run a case without logging, for callers that repeat it such as the soak mode.
+*
+* Arguments come from the per test arena, which the caller resets.
+*
+* @param[out] calls - Number of API calls made
+*
+* @return Number of calls that did not give the expected, valid result, -1 if the
+*         arguments could not be set up
+*/
+long hal_case_call(const hal_case_t *test, size_t *calls);
+
+/**
+* @brief Return the name of an API without the platform_hal_ prefix, NULL if unknown.
+*/
+const char *hal_case_api_name(hal_api_id_t api);
+
+#endif /* __HAL_CASE_H__ */
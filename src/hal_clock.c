@@ -0,0 +1,64 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+* @file hal_clock.c
+* @brief Weakly bound access to the skeleton virtual clock, see hal_clock.h.
+*/
+
+#include <stddef.h>
+#include <stdint.h>
+#include "hal_clock.h"
+#ifdef HAL_INTERPOSE
+#include "hal_trace.h"
+#endif
+
+/* Defined by skeletons/src/skeleton_clock.c; left unresolved when linking a vendor HAL */
+extern void skeleton_clock_advance(uint64_t ms) __attribute__((weak));
+extern int64_t skeleton_clock_skip(void) __attribute__((weak));
+
+int hal_clock_available(void)
+{
+#ifdef HAL_INTERPOSE
+    /* A replayed run never reaches the skeleton, so moving its clock has no effect */
+    if (hal_trace_replaying())
+    {
+        return 0;
+    }
+#endif
+    return (skeleton_clock_advance != NULL && skeleton_clock_skip != NULL);
+}
+
+int hal_clock_advance_ms(uint64_t ms)
+{
+    if (!hal_clock_available())
+    {
+        return -1;
+    }
+    skeleton_clock_advance(ms);
+    return 0;
+}
+
+int64_t hal_clock_skip(void)
+{
+    if (!hal_clock_available())
+    {
+        return -1;
+    }
+    return skeleton_clock_skip();
+}
@@ -0,0 +1,56 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+* @file hal_clock.h
+* @brief Access from the tests to the virtual clock of the Linux skeleton HAL.
+*
+* When the suite is linked with the skeleton, timeouts armed through the HAL (image
+* watchdog, MACsec authentication) run on a virtual clock the tests can move forward, so
+* an expiry is reached instantly. Against a vendor HAL, or when the calls are replayed
+* from a trace (hal_trace.h), there is no such clock and the functions below report it,
+* letting the tests that need it skip themselves.
+*/
+
+#ifndef __HAL_CLOCK_H__
+#define __HAL_CLOCK_H__
+
+#include <stdint.h>
+
+/**
+* @brief Return non zero when the HAL under test runs on a controllable virtual clock.
+*/
+int hal_clock_available(void);
+
+/**
+* @brief Move the virtual clock of the HAL forward without waiting.
+*
+* @param[in] ms - Milliseconds to advance
+*
+* @return 0 on success, -1 when there is no virtual clock
+*/
+int hal_clock_advance_ms(uint64_t ms);
+
+/**
+* @brief Move the virtual clock of the HAL to its earliest pending timeout.
+*
+* @return Milliseconds the clock moved, -1 when no timeout is pending or there is no virtual clock
+*/
+int64_t hal_clock_skip(void);
+
+#endif /* __HAL_CLOCK_H__ */
@@ -0,0 +1,621 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+* @file hal_daemon.c
+* @brief Telemetry sampler with per metric adaptive intervals and a ring file, see hal_daemon.h.
+*/
+
+#include <ut.h>
+#include <ut_log.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <math.h>
+#include <signal.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <time.h>
+#include <unistd.h>
+#include "platform_hal.h"
+#include "hal_daemon.h"
+
+#define NS_PER_S    (1000000000ull)
+#define NS_PER_MS   (1000000ull)
+#define LINE_SIZE   (160)         /* Ring slot, the last byte is the newline */
+#define MAX_VALUES  (4)
+#define MAX_RADIOS  (3)
+#define COST_WEIGHT (0.2)         /* Weight of the newest sample in the cost average */
+
+typedef enum
+{
+    KIND_GAUGE = 0,
+    KIND_COUNTER
+} metric_kind_t;
+
+typedef struct metric metric_t;
+
+/* Returns the number of values read, or -1 when the HAL call failed */
+typedef int (*metric_sample_t)(const metric_t *metric, long long *values);
+
+struct metric
+{
+    const char      *name;
+    char             instance[24];
+    int              index;                /* Fan or radio index */
+    metric_sample_t  sample;
+    metric_kind_t    kind;
+    double           least[MAX_VALUES];    /* Smallest change of each value, per second for counters */
+    long long        last[MAX_VALUES];
+    double           rate[MAX_VALUES];
+    int              count;                /* Values in last, 0 until a sample succeeded */
+    int              rates;                /* rate is valid */
+    uint64_t         lastNs;
+    uint64_t         intervalNs;
+    uint64_t         dueNs;
+    double           costNs;
+    unsigned long    samples;
+    unsigned long    failed;
+};
+
+static int gEnabled = 0;
+static const char *gFile = HAL_DAEMON_DEFAULT_FILE;
+static long gRingKb = HAL_DAEMON_DEFAULT_RING_KB;
+static long gMinIntervalS = HAL_DAEMON_DEFAULT_MIN_INTERVAL_S;
+static long gMaxIntervalS = HAL_DAEMON_DEFAULT_MAX_INTERVAL_S;
+static long gChange = HAL_DAEMON_DEFAULT_CHANGE;
+static double gCpu = HAL_DAEMON_DEFAULT_CPU;
+static volatile sig_atomic_t gStop = 0;
+
+static char *gRing = NULL;
+static size_t gSlots = 0;
+static size_t gHead = 0;
+
+extern char **InterfaceNames;
+extern int num_InterfaceNames;
+extern int *FanIndex;
+extern int num_FanIndex;
+
+static uint64_t clock_ns(clockid_t clock)
+{
+    struct timespec ts;
+
+    clock_gettime(clock, &ts);
+    return (uint64_t)ts.tv_sec * NS_PER_S + (uint64_t)ts.tv_nsec;
+}
+
+static int sample_ifstats(const metric_t *metric, long long *values)
+{
+    INTF_STATS stats;
+
+    memset(&stats, 0, sizeof(stats));
+    if (platform_hal_GetInterfaceStats(metric->instance, &stats) != RETURN_OK)
+    {
+        return -1;
+    }
+    values[0] = (long long)stats.rx_bytes;
+    values[1] = (long long)stats.tx_bytes;
+    values[2] = (long long)stats.rx_packet;
+    values[3] = (long long)stats.tx_packet;
+    return 4;
+}
+
+static int sample_memory(const metric_t *metric, long long *values)
+{
+    ULONG used = 0;
+    ULONG freeSize = 0;
+
+    (void)metric;
+    if (platform_hal_GetUsedMemorySize(&used) != RETURN_OK ||
+        platform_hal_GetFreeMemorySize(&freeSize) != RETURN_OK)
+    {
+        return -1;
+    }
+    values[0] = (long long)used;
+    values[1] = (long long)freeSize;
+    return 2;
+}
+
+static int sample_rpm(const metric_t *metric, long long *values)
+{
+    values[0] = (long long)platform_hal_getRPM((UINT)metric->index);
+    return 1;
+}
+
+#ifdef FEATURE_RDKB_THERMAL_MANAGER
+static int sample_fan_temp(const metric_t *metric, long long *values)
+{
+    INT value = 0;
+
+    (void)metric;
+    if (platform_hal_getFanTemperature(&value) != RETURN_OK)
+    {
+        return -1;
+    }
+    values[0] = value;
+    return 1;
+}
+
+static int sample_power(const metric_t *metric, long long *values)
+{
+    INT value = 0;
+
+    (void)metric;
+    if (platform_hal_getInputPower(&value) != RETURN_OK)
+    {
+        return -1;
+    }
+    values[0] = value;
+    return 1;
+}
+
+static int sample_radio_temp(const metric_t *metric, long long *values)
+{
+    INT value = 0;
+
+    if (platform_hal_getRadioTemperature(metric->index, &value) != RETURN_OK)
+    {
+        return -1;
+    }
+    values[0] = value;
+    return 1;
+}
+
+static int sample_eco_mode(const metric_t *metric, long long *values)
+{
+    INT value = 0;
+
+    if (platform_hal_getEcoModeStatus(metric->index, &value) != RETURN_OK)
+    {
+        return -1;
+    }
+    values[0] = value;
+    return 1;
+}
+#endif
+
+static metric_t *add_metric(metric_t *metrics, size_t *count, const char *name, const char *instance,
+                            int index, metric_sample_t sample, metric_kind_t kind, double least)
+{
+    metric_t *metric = &metrics[(*count)++];
+    int i;
+
+    metric->name = name;
+    snprintf(metric->instance, sizeof(metric->instance), "%s", instance);
+    metric->index = index;
+    metric->sample = sample;
+    metric->kind = kind;
+    for (i = 0; i < MAX_VALUES; i++)
+    {
+        metric->least[i] = least;
+    }
+    metric->intervalNs = (uint64_t)gMinIntervalS * NS_PER_S;
+    return metric;
+}
+
+static metric_t *build_metrics(size_t *count)
+{
+    size_t capacity = (size_t)num_InterfaceNames + (size_t)num_FanIndex + 3 + 2 * MAX_RADIOS;
+    metric_t *metrics = calloc(capacity, sizeof(metric_t));
+    metric_t *metric;
+    char instance[24];
+    int i;
+
+    *count = 0;
+    if (metrics == NULL)
+    {
+        return NULL;
+    }
+    for (i = 0; i < num_InterfaceNames; i++)
+    {
+        /* Counters change all the time, only a change of rate by a KiB/s, or a packet/s for the packet counters, counts */
+        metric = add_metric(metrics, count, "ifstats", InterfaceNames[i], 0, sample_ifstats, KIND_COUNTER, 1024);
+        metric->least[2] = 1;
+        metric->least[3] = 1;
+    }
+    add_metric(metrics, count, "memory", "-", 0, sample_memory, KIND_GAUGE, 256);
+    for (i = 0; i < num_FanIndex; i++)
+    {
+        snprintf(instance, sizeof(instance), "fan%d", FanIndex[i]);
+        add_metric(metrics, count, "rpm", instance, FanIndex[i], sample_rpm, KIND_GAUGE, 50);
+    }
+#ifdef FEATURE_RDKB_THERMAL_MANAGER
+    add_metric(metrics, count, "fan_temp", "-", 0, sample_fan_temp, KIND_GAUGE, 1);
+    add_metric(metrics, count, "power", "-", 0, sample_power, KIND_GAUGE, 1);
+    for (i = 0; i < MAX_RADIOS; i++)
+    {
+        snprintf(instance, sizeof(instance), "radio%d", i);
+        add_metric(metrics, count, "radio_temp", instance, i, sample_radio_temp, KIND_GAUGE, 1);
+    }
+    for (i = 0; i < MAX_RADIOS; i++)
+    {
+        snprintf(instance, sizeof(instance), "radio%d", i);
+        add_metric(metrics, count, "eco_mode", instance, i, sample_eco_mode, KIND_GAUGE, 0);
+    }
+#endif
+    return metrics;
+}
+
+static int differs(double now, double before, double least)
+{
+    double change = fabs(now - before);
+
+    return change > least && change > fabs(before) * (double)gChange / 100.0;
+}
+
+/* Store a successful sample and tell whether it changed from the previous one */
+static int update(metric_t *metric, const long long *values, int count, uint64_t now)
+{
+    double seconds = (double)(now - metric->lastNs) / (double)NS_PER_S;
+    double rate[MAX_VALUES];
+    int changed = (metric->count != count);
+    int i;
+
+    for (i = 0; i < count && !changed; i++)
+    {
+        if (metric->kind == KIND_GAUGE)
+        {
+            changed = differs((double)values[i], (double)metric->last[i], metric->least[i]);
+        }
+    }
+    if (metric->kind == KIND_COUNTER && metric->count == count)
+    {
+        for (i = 0; i < count; i++)
+        {
+            rate[i] = (seconds > 0) ? (double)(values[i] - metric->last[i]) / seconds : 0;
+            /* A counter that went backwards was reset, which is a change in itself */
+            if (values[i] < metric->last[i] || !metric->rates ||
+                differs(rate[i], metric->rate[i], metric->least[i]))
+            {
+                changed = 1;
+            }
+        }
+        memcpy(metric->rate, rate, sizeof(rate));
+        metric->rates = 1;
+    }
+    memcpy(metric->last, values, (size_t)count * sizeof(long long));
+    metric->count = count;
+    metric->lastNs = now;
+    return changed;
+}
+
+static void adapt(metric_t *metric, int changed)
+{
+    uint64_t minimum = (uint64_t)gMinIntervalS * NS_PER_S;
+    uint64_t maximum = (uint64_t)gMaxIntervalS * NS_PER_S;
+
+    metric->intervalNs = changed ? metric->intervalNs / 2 : metric->intervalNs + metric->intervalNs / 2;
+    if (metric->intervalNs < minimum)
+    {
+        metric->intervalNs = minimum;
+    }
+    if (metric->intervalNs > maximum)
+    {
+        metric->intervalNs = maximum;
+    }
+}
+
+/* Factor by which the intervals are stretched to keep the sampling cost within the CPU budget */
+static double stretch(const metric_t *metrics, size_t count)
+{
+    double load = 0;
+    size_t i;
+
+    for (i = 0; i < count; i++)
+    {
+        load += metrics[i].costNs / (double)metrics[i].intervalNs;
+    }
+    load = load * 100.0 / gCpu;
+    return (load > 1.0) ? load : 1.0;
+}
+
+static int open_ring(void)
+{
+    size_t size;
+    struct stat status;
+    char newest[16] = "";
+    size_t i;
+    int fd;
+
+    gSlots = (size_t)gRingKb * 1024 / LINE_SIZE;
+    size = gSlots * LINE_SIZE;
+    fd = open(gFile, O_RDWR | O_CREAT, 0644);
+    if (fd < 0 || fstat(fd, &status) != 0)
+    {
+        printf("Cannot open %s: %s\n", gFile, strerror(errno));
+        if (fd >= 0)
+        {
+            close(fd);
+        }
+        return -1;
+    }
+    if ((size_t)status.st_size != size && ftruncate(fd, (off_t)size) != 0)
+    {
+        printf("Cannot size %s to %zu bytes: %s\n", gFile, size, strerror(errno));
+        close(fd);
+        return -1;
+    }
+    gRing = mmap(NULL, size, PROT_READ | PROT_WRITE, MAP_SHARED, fd, 0);
+    close(fd);
+    if (gRing == MAP_FAILED)
+    {
+        printf("Cannot map %s: %s\n", gFile, strerror(errno));
+        gRing = NULL;
+        return -1;
+    }
+
+    gHead = 0;
+    if ((size_t)status.st_size != size)
+    {
+        /* New or resized ring, blank slots sort first and are skipped by grep */
+        for (i = 0; i < gSlots; i++)
+        {
+            memset(&gRing[i * LINE_SIZE], ' ', LINE_SIZE - 1);
+            gRing[i * LINE_SIZE + LINE_SIZE - 1] = '\n';
+        }
+        return 0;
+    }
+    /* Continue after the newest line, the timestamps are fixed width so they compare as text */
+    for (i = 0; i < gSlots; i++)
+    {
+        if (gRing[i * LINE_SIZE] != ' ' && memcmp(&gRing[i * LINE_SIZE], newest, sizeof(newest) - 1) > 0)
+        {
+            memcpy(newest, &gRing[i * LINE_SIZE], sizeof(newest) - 1);
+            gHead = (i + 1) % gSlots;
+        }
+    }
+    return 0;
+}
+
+static void close_ring(void)
+{
+    if (gRing != NULL)
+    {
+        msync(gRing, gSlots * LINE_SIZE, MS_SYNC);
+        munmap(gRing, gSlots * LINE_SIZE);
+        gRing = NULL;
+    }
+}
+
+static void write_sample(const metric_t *metric, const long long *values, int count, uint64_t nextNs)
+{
+    char line[LINE_SIZE + 32];
+    char *slot = &gRing[gHead * LINE_SIZE];
+    struct timespec ts;
+    size_t length;
+    int i;
+
+    clock_gettime(CLOCK_REALTIME, &ts);
+    length = (size_t)snprintf(line, sizeof(line), "%010lld.%03ld %-10s %-10s",
+                              (long long)ts.tv_sec, ts.tv_nsec / 1000000L, metric->name, metric->instance);
+    if (count < 0)
+    {
+        length += (size_t)snprintf(&line[length], sizeof(line) - length, " error");
+    }
+    for (i = 0; i < count && length < sizeof(line); i++)
+    {
+        length += (size_t)snprintf(&line[length], sizeof(line) - length, " %lld", values[i]);
+    }
+    if (length < sizeof(line))
+    {
+        snprintf(&line[length], sizeof(line) - length, " next %.1fs", (double)nextNs / NS_PER_S);
+    }
+    length = strlen(line);
+    if (length > LINE_SIZE - 1)
+    {
+        length = LINE_SIZE - 1;
+    }
+    memcpy(slot, line, length);
+    memset(&slot[length], ' ', LINE_SIZE - 1 - length);
+    slot[LINE_SIZE - 1] = '\n';
+    gHead = (gHead + 1) % gSlots;
+}
+
+static void stop(int signal)
+{
+    (void)signal;
+    gStop = 1;
+}
+
+int hal_daemon_run(void)
+{
+    struct sigaction action;
+    metric_t *metrics;
+    metric_t *metric;
+    size_t count = 0;
+    size_t i;
+    long long values[MAX_VALUES];
+    unsigned long long samples = 0;
+    uint64_t start;
+    uint64_t startCpu;
+    uint64_t now;
+    uint64_t cost;
+    uint64_t nextNs;
+    double factor = 1.0;
+    struct timespec due;
+    int got;
+
+    metrics = build_metrics(&count);
+    if (metrics == NULL || open_ring() != 0)
+    {
+        free(metrics);
+        return -1;
+    }
+
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = stop;
+    sigemptyset(&action.sa_mask);
+    sigaction(SIGINT, &action, NULL);
+    sigaction(SIGTERM, &action, NULL);
+
+    printf("Daemon sampling %zu metrics every %ld to %ld s within %g%% CPU into %s (%zu lines)\n",
+           count, gMinIntervalS, gMaxIntervalS, gCpu, gFile, gSlots);
+    start = clock_ns(CLOCK_MONOTONIC);
+    startCpu = clock_ns(CLOCK_PROCESS_CPUTIME_ID);
+    for (i = 0; i < count; i++)
+    {
+        metrics[i].dueNs = start;
+    }
+
+    while (!gStop)
+    {
+        metric = &metrics[0];
+        for (i = 1; i < count; i++)
+        {
+            if (metrics[i].dueNs < metric->dueNs)
+            {
+                metric = &metrics[i];
+            }
+        }
+        due.tv_sec = (time_t)(metric->dueNs / NS_PER_S);
+        due.tv_nsec = (long)(metric->dueNs % NS_PER_S);
+        if (clock_nanosleep(CLOCK_MONOTONIC, TIMER_ABSTIME, &due, NULL) != 0)
+        {
+            continue;
+        }
+
+        cost = clock_ns(CLOCK_PROCESS_CPUTIME_ID);
+        got = metric->sample(metric, values);
+        now = clock_ns(CLOCK_MONOTONIC);
+        cost = clock_ns(CLOCK_PROCESS_CPUTIME_ID) - cost;
+        metric->costNs = (metric->samples == 0) ? (double)cost
+                                                : (1.0 - COST_WEIGHT) * metric->costNs + COST_WEIGHT * (double)cost;
+        metric->samples++;
+        samples++;
+        if (got < 0)
+        {
+            metric->failed++;
+            adapt(metric, 0);
+        }
+        else
+        {
+            adapt(metric, update(metric, values, got, now));
+        }
+
+        factor = stretch(metrics, count);
+        nextNs = (uint64_t)((double)metric->intervalNs * factor);
+        metric->dueNs = now + nextNs;
+        write_sample(metric, values, got, nextNs);
+    }
+
+    now = clock_ns(CLOCK_MONOTONIC);
+    printf("Daemon stopped after %.0f s: %llu samples, %.3f%% CPU, last stretch %.2f\n",
+           (double)(now - start) / NS_PER_S, samples,
+           100.0 * (double)(clock_ns(CLOCK_PROCESS_CPUTIME_ID) - startCpu) / (double)(now - start), factor);
+    for (i = 0; i < count; i++)
+    {
+        UT_LOG("daemon: %s %s %lu samples, %lu failed, interval %.1f s, %.0f us per sample",
+               metrics[i].name, metrics[i].instance, metrics[i].samples, metrics[i].failed,
+               (double)metrics[i].intervalNs / NS_PER_S, metrics[i].costNs / 1000.0);
+    }
+    close_ring();
+    free(metrics);
+    return 0;
+}
+
+static int env_number(const char *name, long *value, long minimum)
+{
+    const char *text = getenv(name);
+    char *end = NULL;
+    long number;
+
+    if (text == NULL || *text == '\0')
+    {
+        return 0;
+    }
+    number = strtol(text, &end, 10);
+    if (*end != '\0' || number < minimum)
+    {
+        return -1;
+    }
+    *value = number;
+    return 0;
+}
+
+int hal_daemon_init(int *argc, char **argv)
+{
+    const char *text;
+    char *end = NULL;
+    int i;
+    int j;
+
+    for (i = 1; i < *argc; i++)
+    {
+        if (strcmp(argv[i], HAL_DAEMON_ARG) != 0)
+        {
+            continue;
+        }
+        gEnabled = 1;
+        for (j = i; j + 1 <= *argc; j++)
+        {
+            argv[j] = argv[j + 1];
+        }
+        *argc -= 1;
+        i--;
+    }
+    if (!gEnabled)
+    {
+        return 0;
+    }
+
+    text = getenv(HAL_DAEMON_FILE_ENV);
+    if (text != NULL && *text != '\0')
+    {
+        gFile = text;
+    }
+    if (env_number(HAL_DAEMON_RING_KB_ENV, &gRingKb, 1) != 0)
+    {
+        printf("%s must be a size in KiB of at least 1\n", HAL_DAEMON_RING_KB_ENV);
+        return -1;
+    }
+    if (env_number(HAL_DAEMON_MIN_INTERVAL_ENV, &gMinIntervalS, 1) != 0)
+    {
+        printf("%s must be a number of seconds\n", HAL_DAEMON_MIN_INTERVAL_ENV);
+        return -1;
+    }
+    if (env_number(HAL_DAEMON_MAX_INTERVAL_ENV, &gMaxIntervalS, gMinIntervalS) != 0)
+    {
+        printf("%s must be a number of seconds of at least %s\n", HAL_DAEMON_MAX_INTERVAL_ENV,
+               HAL_DAEMON_MIN_INTERVAL_ENV);
+        return -1;
+    }
+    if (env_number(HAL_DAEMON_CHANGE_ENV, &gChange, 0) != 0)
+    {
+        printf("%s must be a percentage\n", HAL_DAEMON_CHANGE_ENV);
+        return -1;
+    }
+    text = getenv(HAL_DAEMON_CPU_ENV);
+    if (text != NULL && *text != '\0')
+    {
+        gCpu = strtod(text, &end);
+        if (*end != '\0' || !(gCpu > 0.0 && gCpu <= 100.0))
+        {
+            printf("%s must be a percentage above 0 and up to 100\n", HAL_DAEMON_CPU_ENV);
+            return -1;
+        }
+    }
+    return 0;
+}
+
+int hal_daemon_enabled(void)
+{
+    return gEnabled;
+}
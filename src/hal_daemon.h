@@ -0,0 +1,99 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+* @file hal_daemon.h
+* @brief Long lived telemetry sampler reusing the HAL bindings of the suite.
+*
+* "platform_hal_test --daemon" replaces the test run with a sampler that runs until SIGINT
+* or SIGTERM. It stays in the foreground, for systemd or an init script to supervise. The
+* metrics and the HAL calls behind them:
+*
+* | metric     | instances                  | calls                                     | kind    |
+* | ---------- | -------------------------- | ----------------------------------------- | ------- |
+* | ifstats    | InterfaceNames of config   | GetInterfaceStats: rx/tx bytes, packets   | counter |
+* | memory     | -                          | GetUsedMemorySize, GetFreeMemorySize      | gauge   |
+* | rpm        | FanIndex of config         | getRPM                                    | gauge   |
+* | fan_temp   | - (thermal manager)        | getFanTemperature                         | gauge   |
+* | power      | - (thermal manager)        | getInputPower                             | gauge   |
+* | radio_temp | radio0 to 2 (thermal)      | getRadioTemperature                       | gauge   |
+* | eco_mode   | radio0 to 2 (thermal)      | getEcoModeStatus                          | gauge   |
+*
+* Each metric has its own interval, starting at the minimum. A sample that changed, by more
+* than the change threshold relative to the previous one and by more than the metric's own
+* floor, halves the interval; a stable sample or a failed call grows it by half, up to the
+* maximum. Counters are compared by their rate per second. The CPU time of every sample is
+* measured, and when the metrics together would use more than the CPU budget at their
+* intervals, every interval is stretched in proportion.
+*
+* Samples go to a ring file of fixed 160 byte text lines, memory mapped and overwritten
+* oldest first. A restart continues after the newest line. Lines start with the time in
+* seconds since the epoch, so "grep -v '^ *$' FILE | sort" lists them in order:
+*
+*     1760870400.123 ifstats    erouter0   1204 880 12 9 next 2.0s
+*
+* | variable                         | meaning                                  | default                 |
+* | -------------------------------- | ---------------------------------------- | ----------------------- |
+* | PLATFORM_HAL_DAEMON_FILE         | Ring file                                | platform_hal_daemon.ring |
+* | PLATFORM_HAL_DAEMON_RING_KB      | Ring size in KiB                         | 1024                    |
+* | PLATFORM_HAL_DAEMON_MIN_INTERVAL | Shortest interval in seconds             | 1                       |
+* | PLATFORM_HAL_DAEMON_MAX_INTERVAL | Longest interval in seconds              | 300                     |
+* | PLATFORM_HAL_DAEMON_CHANGE       | Change threshold in percent              | 5                       |
+* | PLATFORM_HAL_DAEMON_CPU          | CPU budget in percent of one core        | 1                       |
+*/
+
+#ifndef __HAL_DAEMON_H__
+#define __HAL_DAEMON_H__
+
+#define HAL_DAEMON_ARG              "--daemon"
+#define HAL_DAEMON_FILE_ENV         "PLATFORM_HAL_DAEMON_FILE"
+#define HAL_DAEMON_RING_KB_ENV      "PLATFORM_HAL_DAEMON_RING_KB"
+#define HAL_DAEMON_MIN_INTERVAL_ENV "PLATFORM_HAL_DAEMON_MIN_INTERVAL"
+#define HAL_DAEMON_MAX_INTERVAL_ENV "PLATFORM_HAL_DAEMON_MAX_INTERVAL"
+#define HAL_DAEMON_CHANGE_ENV       "PLATFORM_HAL_DAEMON_CHANGE"
+#define HAL_DAEMON_CPU_ENV          "PLATFORM_HAL_DAEMON_CPU"
+
+#define HAL_DAEMON_DEFAULT_FILE           "platform_hal_daemon.ring"
+#define HAL_DAEMON_DEFAULT_RING_KB        (1024)
+#define HAL_DAEMON_DEFAULT_MIN_INTERVAL_S (1)
+#define HAL_DAEMON_DEFAULT_MAX_INTERVAL_S (300)
+#define HAL_DAEMON_DEFAULT_CHANGE         (5)
+#define HAL_DAEMON_DEFAULT_CPU            (1)
+
+/**
+* @brief Take "--daemon" out of the command line and read the configuration.
+*
+* The remaining arguments are left for UT_init().
+*
+* @return 0 on success, -1 on an invalid configuration
+*/
+int hal_daemon_init(int *argc, char **argv);
+
+/**
+* @brief Return non zero when the command line asked for the daemon.
+*/
+int hal_daemon_enabled(void);
+
+/**
+* @brief Sample the metrics until SIGINT or SIGTERM.
+*
+* @return 0 after a signal, -1 if the ring file could not be set up
+*/
+int hal_daemon_run(void);
+
+#endif /* __HAL_DAEMON_H__ */
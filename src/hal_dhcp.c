@@ -0,0 +1,120 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+* @file hal_dhcp.c
+* @brief DHCP option list walker, see hal_dhcp.h.
+*/
+
+#include <stdlib.h>
+#include <string.h>
+#include "hal_dhcp.h"
+
+void hal_dhcp_optset_init(hal_dhcp_optset_t *set, const UINT *options, size_t count)
+{
+    size_t i;
+
+    memset(set, 0, sizeof(*set));
+    for (i = 0; i < count; i++)
+    {
+        if (options[i] < 256)
+        {
+            set->bits[options[i] >> 6] |= (uint64_t)1 << (options[i] & 63);
+        }
+    }
+}
+
+int hal_dhcp_optset_has(const hal_dhcp_optset_t *set, UINT option)
+{
+    if (option >= 256)
+    {
+        return 0;
+    }
+    return (int)((set->bits[option >> 6] >> (option & 63)) & 1);
+}
+
+/* Floyd's tortoise and hare: counts the distinct nodes, which is the tail plus the loop when there is one */
+static size_t count_nodes(const dhcp_opt_list *list, int *cycle)
+{
+    const dhcp_opt_list *slow = list;
+    const dhcp_opt_list *fast = list;
+    size_t count = 0;
+
+    *cycle = 0;
+    while (fast != NULL && fast->next != NULL)
+    {
+        slow = slow->next;
+        fast = fast->next->next;
+        if (slow == fast)
+        {
+            /* Restarting one pointer from the head, both meet again at the start of the loop */
+            for (slow = list; slow != fast; slow = slow->next, fast = fast->next)
+            {
+                count++;
+            }
+            count++;
+            for (fast = slow->next; fast != slow; fast = fast->next)
+            {
+                count++;
+            }
+            *cycle = 1;
+            return count;
+        }
+    }
+    for (slow = list; slow != NULL; slow = slow->next)
+    {
+        count++;
+    }
+    return count;
+}
+
+int hal_dhcp_walk(const dhcp_opt_list *list, const hal_dhcp_optset_t *allowed, hal_dhcp_walk_t *walk)
+{
+    const dhcp_opt_list *node = list;
+    size_t i;
+
+    memset(walk, 0, sizeof(*walk));
+    walk->length = count_nodes(list, &walk->cycle);
+    for (i = 0; i < walk->length; i++, node = node->next)
+    {
+        walk->allocations += (node->dhcp_opt_val != NULL) ? 2 : 1;
+        if (!hal_dhcp_optset_has(allowed, node->dhcp_opt))
+        {
+            if (walk->invalid == 0)
+            {
+                walk->firstInvalid = node->dhcp_opt;
+            }
+            walk->invalid++;
+        }
+    }
+    return (walk->cycle == 0 && walk->invalid == 0);
+}
+
+void hal_dhcp_free(dhcp_opt_list *list, const hal_dhcp_walk_t *walk)
+{
+    size_t i;
+
+    for (i = 0; list != NULL && i < walk->length; i++)
+    {
+        dhcp_opt_list *next = list->next;
+
+        free(list->dhcp_opt_val);
+        free(list);
+        list = next;
+    }
+}
@@ -0,0 +1,91 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+* @file hal_dhcp.h
+* @brief Validation and release of the DHCP option lists returned by platform_hal_GetDhcpv4_Options() and platform_hal_GetDhcpv6_Options().
+*
+* The HAL returns each list as a chain of dhcp_opt_list nodes, each node and its option value
+* allocated separately. The walk follows the whole chain, tests every option against a 256 bit
+* membership set and uses Floyd's cycle detection so that a corrupted next pointer is reported
+* rather than followed forever. hal_dhcp_free() then releases exactly the nodes the walk reached.
+*/
+
+#ifndef __HAL_DHCP_H__
+#define __HAL_DHCP_H__
+
+#include <stddef.h>
+#include <stdint.h>
+#include "platform_hal.h"
+
+/**
+* @brief Set of permitted option codes. Codes above 255 are never members.
+*/
+typedef struct
+{
+    uint64_t bits[4];
+} hal_dhcp_optset_t;
+
+/**
+* @brief Result of walking one option list.
+*/
+typedef struct
+{
+    size_t length;       /**< Distinct nodes in the list, including those on a cycle */
+    size_t allocations;  /**< Heap blocks owned by the list: every node plus every non NULL option value */
+    size_t invalid;      /**< Nodes whose option code is not in the permitted set */
+    UINT firstInvalid;   /**< Option code of the first such node */
+    int cycle;           /**< 1 if the next pointers loop back into the list */
+} hal_dhcp_walk_t;
+
+/**
+* @brief Build a membership set from an array of option codes.
+*
+* @param[out] set     - Set to fill
+* @param[in]  options - Option codes
+* @param[in]  count   - Number of option codes
+*/
+void hal_dhcp_optset_init(hal_dhcp_optset_t *set, const UINT *options, size_t count);
+
+/**
+* @brief Check whether an option code is in a set.
+*
+* @return 1 if it is, 0 otherwise
+*/
+int hal_dhcp_optset_has(const hal_dhcp_optset_t *set, UINT option);
+
+/**
+* @brief Walk a whole option list.
+*
+* @param[in]  list    - Head of the list, may be NULL
+* @param[in]  allowed - Permitted option codes
+* @param[out] walk    - Result of the walk
+*
+* @return 1 if the list is acyclic and every option is permitted, 0 otherwise
+*/
+int hal_dhcp_walk(const dhcp_opt_list *list, const hal_dhcp_optset_t *allowed, hal_dhcp_walk_t *walk);
+
+/**
+* @brief Free every node of a list and its option value.
+*
+* @param[in] list - Head of the list, may be NULL
+* @param[in] walk - Result of hal_dhcp_walk() on the same list, bounding a cyclic list
+*/
+void hal_dhcp_free(dhcp_opt_list *list, const hal_dhcp_walk_t *walk);
+
+#endif /* __HAL_DHCP_H__ */
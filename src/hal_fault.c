@@ -0,0 +1,370 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+* @file hal_fault.c
+* @brief Probabilistic fault injection hook for the HAL interposer, see hal_fault.h.
+*/
+
+#ifdef HAL_INTERPOSE
+
+#include <ut_log.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <errno.h>
+#include <unistd.h>
+#include <pthread.h>
+#include "cJSON.h"
+#include "hal_interpose.h"
+#include "hal_fault.h"
+#include "hal_log.h"
+
+#define DEFAULT_CORRUPT_BYTES  (4)
+#define MAX_DHCP_NODES         (256)
+
+typedef struct
+{
+    int      set;
+    double   error;
+    double   corrupt;
+    double   delay;
+    double   hang;
+    uint32_t delayMs;
+    uint32_t hangMs;
+    uint32_t corruptBytes;
+} fault_profile_t;
+
+typedef struct
+{
+    unsigned long calls;
+    unsigned long error;
+    unsigned long corrupt;
+    unsigned long delay;
+    unsigned long hang;
+} fault_stats_t;
+
+static fault_profile_t gDefault;
+static fault_profile_t gProfiles[HAL_API_COUNT];
+static fault_stats_t gStats[HAL_API_COUNT];
+static pthread_mutex_t gRandomLock = PTHREAD_MUTEX_INITIALIZER;
+static uint64_t gRandomState;
+static uint64_t gSeed;
+static __thread const fault_profile_t *tPendingCorrupt = NULL;
+
+/* One splitmix64 stream for the whole run, so a single threaded suite is repeatable */
+static uint64_t next_random(void)
+{
+    uint64_t z;
+
+    pthread_mutex_lock(&gRandomLock);
+    z = (gRandomState += 0x9E3779B97F4A7C15ull);
+    pthread_mutex_unlock(&gRandomLock);
+    z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ull;
+    z = (z ^ (z >> 27)) * 0x94D049BB133111EBull;
+    return z ^ (z >> 31);
+}
+
+static double random_unit(void)
+{
+    return (double)(next_random() >> 11) * (1.0 / 9007199254740992.0);
+}
+
+static void sleep_ms(uint32_t ms)
+{
+    struct timespec ts;
+
+    ts.tv_sec = (time_t)(ms / 1000);
+    ts.tv_nsec = (long)(ms % 1000) * 1000000L;
+    while (nanosleep(&ts, &ts) != 0 && errno == EINTR)
+    {
+    }
+}
+
+static char *read_config(const char *filename)
+{
+    FILE *file = fopen(filename, "r");
+    long length = 0;
+    char *content = NULL;
+
+    if (file == NULL)
+    {
+        return NULL;
+    }
+    if (fseek(file, 0, SEEK_END) == 0 && (length = ftell(file)) > 0 && fseek(file, 0, SEEK_SET) == 0)
+    {
+        content = (char*)malloc((size_t)length + 1);
+        if (content != NULL)
+        {
+            if (fread(content, 1, (size_t)length, file) != (size_t)length)
+            {
+                free(content);
+                content = NULL;
+            }
+            else
+            {
+                content[length] = '\0';
+            }
+        }
+    }
+    fclose(file);
+    return content;
+}
+
+static double number_item(const cJSON *object, const char *name, double defaultValue)
+{
+    const cJSON *item = cJSON_GetObjectItem(object, name);
+
+    return cJSON_IsNumber(item) ? cJSON_GetNumberValue(item) : defaultValue;
+}
+
+static void parse_profile(const cJSON *object, fault_profile_t *profile)
+{
+    profile->set = 1;
+    profile->error = number_item(object, "error", 0);
+    profile->corrupt = number_item(object, "corrupt", 0);
+    profile->delay = number_item(object, "delay", 0);
+    profile->hang = number_item(object, "hang", 0);
+    profile->delayMs = (uint32_t)number_item(object, "delay_ms", 100);
+    profile->hangMs = (uint32_t)number_item(object, "hang_ms", 0);
+    profile->corruptBytes = (uint32_t)number_item(object, "corrupt_bytes", DEFAULT_CORRUPT_BYTES);
+}
+
+/* Flips bits in non zero bytes only, so string terminators stay where they were */
+static void flip_bytes(unsigned char *buf, size_t length, uint32_t count)
+{
+    uint32_t i;
+
+    for (i = 0; buf != NULL && length > 0 && i < count; i++)
+    {
+        size_t index = (size_t)(next_random() % length);
+        unsigned char flipped;
+
+        if (buf[index] == 0)
+        {
+            continue;
+        }
+        flipped = (unsigned char)(buf[index] ^ (unsigned char)(1 + next_random() % 255));
+        buf[index] = flipped ? flipped : 0x01;
+    }
+}
+
+static void corrupt_dhcp(dhcp_opt_list *node, uint32_t count)
+{
+    int i;
+
+    for (i = 0; node != NULL && i < MAX_DHCP_NODES; i++, node = node->next)
+    {
+        flip_bytes((unsigned char *)&node->dhcp_opt, sizeof(node->dhcp_opt), 1);
+        if (node->dhcp_opt_val != NULL)
+        {
+            flip_bytes((unsigned char *)node->dhcp_opt_val, strlen(node->dhcp_opt_val), count);
+        }
+    }
+}
+
+/* Returns the number of outputs that were corrupted */
+static int corrupt_outputs(hal_call_t *call, uint32_t count)
+{
+    int corrupted = 0;
+    int i;
+
+    for (i = 0; i < call->argCount; i++)
+    {
+        hal_arg_t *arg = &call->args[i];
+
+        if (arg->ptr == NULL)
+        {
+            continue;
+        }
+        switch (arg->kind)
+        {
+            case HAL_ARG_KIND_STR_OUT:
+                flip_bytes((unsigned char *)arg->ptr, strlen((char *)arg->ptr), count);
+                break;
+            case HAL_ARG_KIND_MEM_OUT:
+                flip_bytes((unsigned char *)arg->ptr, arg->size, count);
+                break;
+            case HAL_ARG_KIND_MEM_OUT_REF:
+                flip_bytes(*(unsigned char **)arg->ptr, arg->size, count);
+                break;
+            case HAL_ARG_KIND_DHCP_OUT:
+                corrupt_dhcp(*(dhcp_opt_list **)arg->ptr, count);
+                break;
+            default:
+                continue;
+        }
+        corrupted++;
+    }
+    return corrupted;
+}
+
+static void fault_begin(hal_call_t *call)
+{
+    const fault_profile_t *profile = gProfiles[call->id].set ? &gProfiles[call->id] : &gDefault;
+    fault_stats_t *stats = &gStats[call->id];
+    double draw;
+
+    __atomic_add_fetch(&stats->calls, 1, __ATOMIC_RELAXED);
+    if (!profile->set)
+    {
+        return;
+    }
+    draw = random_unit();
+    if (draw < profile->error)
+    {
+        __atomic_add_fetch(&stats->error, 1, __ATOMIC_RELAXED);
+        UT_LOG("fault: platform_hal_%s forced to fail", call->api);
+        call->ret = (call->retKind == HAL_RET_STATUS) ? RETURN_ERR : 0;
+        call->skip = 1;
+        return;
+    }
+    draw -= profile->error;
+    if (draw < profile->corrupt)
+    {
+        tPendingCorrupt = profile;
+        return;
+    }
+    draw -= profile->corrupt;
+    if (draw < profile->delay)
+    {
+        __atomic_add_fetch(&stats->delay, 1, __ATOMIC_RELAXED);
+        UT_LOG("fault: platform_hal_%s delayed by %u ms", call->api, profile->delayMs);
+        sleep_ms(profile->delayMs);
+        return;
+    }
+    draw -= profile->delay;
+    if (draw < profile->hang)
+    {
+        __atomic_add_fetch(&stats->hang, 1, __ATOMIC_RELAXED);
+        if (profile->hangMs == 0)
+        {
+            UT_LOG("fault: platform_hal_%s hung", call->api);
+            for (;;)
+            {
+                sleep(60);
+            }
+        }
+        UT_LOG("fault: platform_hal_%s hung for %u ms", call->api, profile->hangMs);
+        sleep_ms(profile->hangMs);
+    }
+}
+
+static void fault_end(hal_call_t *call)
+{
+    const fault_profile_t *profile = tPendingCorrupt;
+
+    if (profile == NULL)
+    {
+        return;
+    }
+    tPendingCorrupt = NULL;
+    if (call->retKind == HAL_RET_VALUE)
+    {
+        call->ret ^= (long long)(1 + next_random() % 0xFFFF);
+    }
+    else if (call->ret != RETURN_OK || corrupt_outputs(call, profile->corruptBytes) == 0)
+    {
+        return;
+    }
+    __atomic_add_fetch(&gStats[call->id].corrupt, 1, __ATOMIC_RELAXED);
+    UT_LOG("fault: platform_hal_%s outputs corrupted", call->api);
+}
+
+static void print_summary(void)
+{
+    int i;
+
+    printf("\nInjected faults (seed %llu)\n", (unsigned long long)gSeed);
+    printf("%-32s %8s %8s %8s %8s %8s\n", "api", "calls", "error", "corrupt", "delay", "hang");
+    for (i = 0; i < HAL_API_COUNT; i++)
+    {
+        const fault_stats_t *stats = &gStats[i];
+
+        if (stats->error + stats->corrupt + stats->delay + stats->hang == 0)
+        {
+            continue;
+        }
+        printf("%-32s %8lu %8lu %8lu %8lu %8lu\n", hal_interpose_api_name((hal_api_id_t)i),
+               stats->calls, stats->error, stats->corrupt, stats->delay, stats->hang);
+    }
+}
+
+static const hal_interpose_hook_t gFaultHook =
+{
+    .name = "fault",
+    .begin = fault_begin,
+    .end = fault_end,
+};
+
+int hal_fault_init(void)
+{
+    const char *path = getenv(HAL_FAULT_CONFIG_ENV);
+    const cJSON *item = NULL;
+    cJSON *config = NULL;
+    char *content = NULL;
+
+    if (path == NULL)
+    {
+        path = HAL_FAULT_CONFIG_FILE;
+    }
+    content = read_config(path);
+    if (content == NULL)
+    {
+        return 0;
+    }
+    config = cJSON_Parse(content);
+    free(content);
+    if (config == NULL)
+    {
+        printf("Failed to parse %s\n", path);
+        return -1;
+    }
+
+    gSeed = (uint64_t)number_item(config, "seed", (double)time(NULL));
+    gRandomState = gSeed;
+    cJSON_ArrayForEach(item, config)
+    {
+        hal_api_id_t id;
+
+        if (!cJSON_IsObject(item))
+        {
+            continue;
+        }
+        if (!strcmp(item->string, "default"))
+        {
+            parse_profile(item, &gDefault);
+            continue;
+        }
+        id = hal_interpose_find_api(item->string);
+        if (id == HAL_API_COUNT)
+        {
+            printf("%s: unknown API %s\n", path, item->string);
+            continue;
+        }
+        parse_profile(item, &gProfiles[id]);
+    }
+    cJSON_Delete(config);
+
+    UT_LOG("fault injection enabled from %s, seed %llu", path, (unsigned long long)gSeed);
+    atexit(print_summary);
+    return hal_interpose_register(&gFaultHook);
+}
+
+#endif /* HAL_INTERPOSE */
@@ -0,0 +1,52 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+* @file hal_fault.h
+* @brief Probabilistic fault injection on top of the HAL interposer.
+*
+* Faults are read from "fault_config" in the working directory, or from the file named by
+* the PLATFORM_HAL_FAULT_CONFIG environment variable. Each key is an API name, with or
+* without the "platform_hal_" prefix, plus the optional "default" and "seed" keys:
+*
+* | key           | meaning                                                                |
+* | ------------- | ---------------------------------------------------------------------- |
+* | error         | Probability of returning RETURN_ERR (0 for value APIs) without a call   |
+* | corrupt       | Probability of flipping bits in the outputs of a successful call       |
+* | delay         | Probability of delaying the call by delay_ms (default 100)             |
+* | hang          | Probability of blocking the call for hang_ms, 0 (default) is forever   |
+* | corrupt_bytes | Bytes flipped per corrupted output, default 4                          |
+*
+* One draw per call selects at most one fault. Injected faults are logged with UT_LOG and
+* summarised per API when the suite exits.
+*/
+
+#ifndef __HAL_FAULT_H__
+#define __HAL_FAULT_H__
+
+#define HAL_FAULT_CONFIG_FILE "./fault_config"
+#define HAL_FAULT_CONFIG_ENV  "PLATFORM_HAL_FAULT_CONFIG"
+
+/**
+* @brief Load the fault config and register the fault hook with the interposer.
+*
+* @return 0 when no config is present or the hook was registered, -1 on error
+*/
+int hal_fault_init(void);
+
+#endif /* __HAL_FAULT_H__ */
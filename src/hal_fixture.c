@@ -0,0 +1,187 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+* @file hal_fixture.c
+* @brief Trampolines that run the per test hooks around each registered test.
+*/
+
+#define HAL_FIXTURE_NO_WRAP
+#include <stdio.h>
+#include "hal_fixture.h"
+
+#define HAL_FIXTURE_MAX_HOOKS (8)
+
+static const hal_fixture_hook_t *gHooks[HAL_FIXTURE_MAX_HOOKS];
+static int gHookCount = 0;
+
+static struct
+{
+    const char     *name;
+    UT_TestFunction function;
+    void          (*dataFunction)(const void *context);
+    const void     *context;
+    int             hooked;
+} gTests[HAL_FIXTURE_MAX_TRAMPOLINES];
+static int gTestCount = 0;
+static int gHookedCount = 0;
+
+static const char *gCurrent = NULL;
+static int gRepeat = 0;
+static int gRepeating = 0;
+
+int hal_fixture_register(const hal_fixture_hook_t *hook)
+{
+    if (hook == NULL || gHookCount >= HAL_FIXTURE_MAX_HOOKS)
+    {
+        return -1;
+    }
+    gHooks[gHookCount++] = hook;
+    return 0;
+}
+
+const char *hal_fixture_current(void)
+{
+    return gCurrent;
+}
+
+void hal_fixture_repeat(void)
+{
+    if (gCurrent != NULL && !gRepeating)
+    {
+        gRepeat = 1;
+    }
+}
+
+int hal_fixture_repeating(void)
+{
+    return gRepeating;
+}
+
+static void run_once(int index)
+{
+    int i;
+
+    for (i = 0; i < gHookCount; i++)
+    {
+        if (gHooks[i]->before != NULL)
+        {
+            gHooks[i]->before(gCurrent);
+        }
+    }
+    if (gTests[index].function != NULL)
+    {
+        gTests[index].function();
+    }
+    else
+    {
+        gTests[index].dataFunction(gTests[index].context);
+    }
+    for (i = gHookCount - 1; i >= 0; i--)
+    {
+        if (gHooks[i]->after != NULL)
+        {
+            gHooks[i]->after(gCurrent);
+        }
+    }
+}
+
+static void run_test(int index)
+{
+    if (!gTests[index].hooked)
+    {
+        gTests[index].dataFunction(gTests[index].context);
+        return;
+    }
+    gCurrent = gTests[index].name;
+    gRepeat = 0;
+    gRepeating = 0;
+    run_once(index);
+    if (gRepeat)
+    {
+        gRepeating = 1;
+        run_once(index);
+    }
+    gRepeat = 0;
+    gRepeating = 0;
+    gCurrent = NULL;
+}
+
+/* One trampoline per test slot, numbered by a bank and three octal digits to give 512 per bank */
+#define TRAMPOLINE(n, a, b, c) static void trampoline_##n##a##b##c(void) { run_test((n) * 512 + (a) * 64 + (b) * 8 + (c)); }
+#define TRAMPOLINE_8(n, a, b) TRAMPOLINE(n, a, b, 0) TRAMPOLINE(n, a, b, 1) TRAMPOLINE(n, a, b, 2) TRAMPOLINE(n, a, b, 3) \
+                              TRAMPOLINE(n, a, b, 4) TRAMPOLINE(n, a, b, 5) TRAMPOLINE(n, a, b, 6) TRAMPOLINE(n, a, b, 7)
+#define TRAMPOLINE_64(n, a) TRAMPOLINE_8(n, a, 0) TRAMPOLINE_8(n, a, 1) TRAMPOLINE_8(n, a, 2) TRAMPOLINE_8(n, a, 3) \
+                            TRAMPOLINE_8(n, a, 4) TRAMPOLINE_8(n, a, 5) TRAMPOLINE_8(n, a, 6) TRAMPOLINE_8(n, a, 7)
+#define TRAMPOLINE_512(n) TRAMPOLINE_64(n, 0) TRAMPOLINE_64(n, 1) TRAMPOLINE_64(n, 2) TRAMPOLINE_64(n, 3) \
+                          TRAMPOLINE_64(n, 4) TRAMPOLINE_64(n, 5) TRAMPOLINE_64(n, 6) TRAMPOLINE_64(n, 7)
+
+TRAMPOLINE_512(0) TRAMPOLINE_512(1)
+
+#define ENTRY(n, a, b, c) trampoline_##n##a##b##c,
+#define ENTRY_8(n, a, b) ENTRY(n, a, b, 0) ENTRY(n, a, b, 1) ENTRY(n, a, b, 2) ENTRY(n, a, b, 3) \
+                         ENTRY(n, a, b, 4) ENTRY(n, a, b, 5) ENTRY(n, a, b, 6) ENTRY(n, a, b, 7)
+#define ENTRY_64(n, a) ENTRY_8(n, a, 0) ENTRY_8(n, a, 1) ENTRY_8(n, a, 2) ENTRY_8(n, a, 3) \
+                       ENTRY_8(n, a, 4) ENTRY_8(n, a, 5) ENTRY_8(n, a, 6) ENTRY_8(n, a, 7)
+#define ENTRY_512(n) ENTRY_64(n, 0) ENTRY_64(n, 1) ENTRY_64(n, 2) ENTRY_64(n, 3) \
+                     ENTRY_64(n, 4) ENTRY_64(n, 5) ENTRY_64(n, 6) ENTRY_64(n, 7)
+
+static const UT_TestFunction gTrampolines[HAL_FIXTURE_MAX_TRAMPOLINES] =
+{
+    ENTRY_512(0) ENTRY_512(1)
+};
+
+UT_TestFunction hal_fixture_wrap(const char *name, UT_TestFunction function)
+{
+    if (function == NULL)
+    {
+        return NULL;
+    }
+    if (gHookedCount >= HAL_FIXTURE_MAX_TESTS)
+    {
+        printf("hal_fixture: no trampoline left for %s, per test hooks will not run for it\n", name);
+        return function;
+    }
+    gTests[gTestCount].name = name;
+    gTests[gTestCount].function = function;
+    gTests[gTestCount].hooked = 1;
+    gHookedCount++;
+    return gTrampolines[gTestCount++];
+}
+
+UT_TestFunction hal_fixture_wrap_data(const char *name, void (*function)(const void *context), const void *context)
+{
+    if (function == NULL || gTestCount >= HAL_FIXTURE_MAX_TRAMPOLINES)
+    {
+        return NULL;
+    }
+    /* Past the hooked tests a data test still needs a trampoline to carry its context, but runs without the hooks */
+    gTests[gTestCount].hooked = (gHookedCount < HAL_FIXTURE_MAX_TESTS);
+    if (gTests[gTestCount].hooked)
+    {
+        gHookedCount++;
+    }
+    else
+    {
+        printf("hal_fixture: no trampoline left for %s, per test hooks will not run for it\n", name);
+    }
+    gTests[gTestCount].name = name;
+    gTests[gTestCount].dataFunction = function;
+    gTests[gTestCount].context = context;
+    return gTrampolines[gTestCount++];
+}
@@ -0,0 +1,99 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+* @file hal_fixture.h
+* @brief Per test set up and tear down hooks for the suite.
+*
+* ut-core only offers suite level init and cleanup. A test file that includes this header
+* after ut.h registers every test through hal_fixture_wrap(), which hands ut-core a
+* trampoline instead of the test function. The trampoline runs the before hooks in
+* registration order, the test, and the after hooks in reverse order, so harness services
+* such as the per test arena (hal_arena.h) are reset however the test ends.
+*
+* An after hook can ask for the test to run once more, hooks included, to tell effects that
+* happen once in a process, such as a HAL opening a file on first use, from effects of every
+* call (hal_footprint.h).
+*/
+
+#ifndef __HAL_FIXTURE_H__
+#define __HAL_FIXTURE_H__
+
+#include <ut.h>
+
+#define HAL_FIXTURE_MAX_TESTS       (512)
+#define HAL_FIXTURE_MAX_TRAMPOLINES (2 * HAL_FIXTURE_MAX_TESTS)
+
+/**
+* @brief A per test hook. Either function may be NULL.
+*/
+typedef struct
+{
+    const char *name;
+    void (*before)(const char *test);
+    void (*after)(const char *test);
+} hal_fixture_hook_t;
+
+/**
+* @brief Register a hook. Must be called before the tests start.
+*
+* @return 0 on success, -1 if the hook table is full
+*/
+int hal_fixture_register(const hal_fixture_hook_t *hook);
+
+/**
+* @brief Return the trampoline that runs a test between the hooks.
+*
+* Beyond HAL_FIXTURE_MAX_TESTS tests the function itself is returned and the hooks are not
+* run for it.
+*/
+UT_TestFunction hal_fixture_wrap(const char *name, UT_TestFunction function);
+
+/**
+* @brief Return a trampoline that runs function(context) between the hooks, for tests
+* described by data rather than code.
+*
+* Beyond HAL_FIXTURE_MAX_TESTS tests, as for hal_fixture_wrap(), the hooks are not run for it;
+* the trampoline only passes the context.
+*
+* @return The trampoline, or NULL once HAL_FIXTURE_MAX_TRAMPOLINES tests are registered
+*/
+UT_TestFunction hal_fixture_wrap_data(const char *name, void (*function)(const void *context), const void *context);
+
+/**
+* @brief Return the name of the running test, or NULL outside a test.
+*/
+const char *hal_fixture_current(void);
+
+/**
+* @brief From an after hook, run the current test once more when the after hooks are done.
+*
+* The test runs at most twice, so a request made during the repeat is ignored.
+*/
+void hal_fixture_repeat(void);
+
+/**
+* @brief Return non zero while the current test runs for the second time.
+*/
+int hal_fixture_repeating(void);
+
+#ifndef HAL_FIXTURE_NO_WRAP
+#define UT_add_test(suite, name, function) (UT_add_test)((suite), (name), hal_fixture_wrap((name), (function)))
+#endif
+
+#endif /* __HAL_FIXTURE_H__ */
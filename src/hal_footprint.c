@@ -0,0 +1,318 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+* @file hal_footprint.c
+* @brief Per test resource sampling from /proc/self, see hal_footprint.h.
+*/
+
+#include <ut.h>
+#include <ut_log.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <sys/syscall.h>
+#include "hal_fixture.h"
+#include "hal_footprint.h"
+#include "hal_log.h"
+
+#define MAX_FLAGGED (64)
+
+typedef struct
+{
+    long rssKb;
+    long dataKb;
+    long fds;
+    long threads;
+} growth_t;
+
+/* How a flagged test grew the footprint, which also picks its table in the summary */
+typedef enum
+{
+    GROWTH_SINGLE_RUN = 0,  /* Report mode, the test ran once */
+    GROWTH_EVERY_RUN,       /* Fail mode, the test grew it again when repeated */
+    GROWTH_FIRST_RUN,       /* Fail mode, the test did not grow it when repeated */
+    GROWTH_KINDS
+} growth_kind_t;
+
+typedef enum
+{
+    MODE_OFF = 0,
+    MODE_REPORT,
+    MODE_FAIL
+} footprint_mode_t;
+
+typedef struct
+{
+    const char   *test;
+    long          rssKb;
+    long          dataKb;
+    long          fds;
+    long          threads;
+    growth_kind_t kind;
+} flagged_t;
+
+static footprint_mode_t gMode = MODE_REPORT;
+static long gSlackKb = HAL_FOOTPRINT_DEFAULT_SLACK_KB;
+static hal_footprint_t gBefore;
+static flagged_t gFlagged[MAX_FLAGGED];
+static int gFlaggedCount = 0;
+static int gFlaggedTotal[GROWTH_KINDS] = { 0 };
+static growth_t gFirst;
+
+/* Files are read with plain system calls into stack buffers so that sampling does not move what it measures */
+static ssize_t read_proc(const char *path, char *buffer, size_t size)
+{
+    ssize_t length;
+    int fd = open(path, O_RDONLY);
+
+    if (fd < 0)
+    {
+        return -1;
+    }
+    length = read(fd, buffer, size - 1);
+    close(fd);
+    if (length < 0)
+    {
+        return -1;
+    }
+    buffer[length] = '\0';
+    return length;
+}
+
+static long status_field(const char *status, const char *name)
+{
+    const char *field = strstr(status, name);
+
+    return (field != NULL) ? strtol(field + strlen(name), NULL, 10) : -1;
+}
+
+static long count_fds(void)
+{
+    char buffer[4096];
+    long count = 0;
+    long length;
+    long offset;
+    int fd = open("/proc/self/fd", O_RDONLY | O_DIRECTORY);
+
+    if (fd < 0)
+    {
+        return -1;
+    }
+    while ((length = syscall(SYS_getdents64, fd, buffer, sizeof(buffer))) > 0)
+    {
+        for (offset = 0; offset < length; )
+        {
+            /* struct linux_dirent64: d_ino, d_off, d_reclen, d_type, d_name */
+            unsigned short reclen;
+            const char *name = buffer + offset + 19;
+
+            memcpy(&reclen, buffer + offset + 16, sizeof(reclen));
+            if (strcmp(name, ".") != 0 && strcmp(name, "..") != 0)
+            {
+                count++;
+            }
+            offset += reclen;
+        }
+    }
+    close(fd);
+    /* Leave out the descriptor used for the listing */
+    return count - 1;
+}
+
+void hal_footprint_sample(hal_footprint_t *footprint)
+{
+    char buffer[8192];
+    const char *fields;
+
+    memset(footprint, 0, sizeof(*footprint));
+    if (read_proc("/proc/self/status", buffer, sizeof(buffer)) > 0)
+    {
+        footprint->rssKb = status_field(buffer, "\nVmRSS:");
+        footprint->hwmKb = status_field(buffer, "\nVmHWM:");
+        footprint->dataKb = status_field(buffer, "\nVmData:");
+        footprint->threads = status_field(buffer, "\nThreads:");
+    }
+    /* Fields 10 and 12 of stat, counted after the parenthesised command name */
+    if (read_proc("/proc/self/stat", buffer, sizeof(buffer)) > 0 && (fields = strrchr(buffer, ')')) != NULL)
+    {
+        sscanf(fields + 1, " %*c %*d %*d %*d %*d %*d %*u %lu %*u %lu", &footprint->minorFaults, &footprint->majorFaults);
+    }
+    footprint->fds = count_fds();
+}
+
+static void footprint_before(const char *test)
+{
+    (void)test;
+    hal_footprint_sample(&gBefore);
+}
+
+static int grew(const growth_t *growth)
+{
+    return growth->fds > 0 || growth->threads > 0 || growth->rssKb > gSlackKb || growth->dataKb > gSlackKb;
+}
+
+static void flag(const char *test, const growth_t *growth, growth_kind_t kind)
+{
+    if (gFlaggedCount < MAX_FLAGGED)
+    {
+        gFlagged[gFlaggedCount].test = test;
+        gFlagged[gFlaggedCount].rssKb = growth->rssKb;
+        gFlagged[gFlaggedCount].dataKb = growth->dataKb;
+        gFlagged[gFlaggedCount].fds = growth->fds;
+        gFlagged[gFlaggedCount].threads = growth->threads;
+        gFlagged[gFlaggedCount].kind = kind;
+        gFlaggedCount++;
+    }
+    gFlaggedTotal[kind]++;
+}
+
+static void footprint_after(const char *test)
+{
+    hal_footprint_t after;
+    growth_t growth;
+
+    hal_footprint_sample(&after);
+    growth.rssKb = after.rssKb - gBefore.rssKb;
+    growth.dataKb = after.dataKb - gBefore.dataKb;
+    growth.fds = after.fds - gBefore.fds;
+    growth.threads = after.threads - gBefore.threads;
+    HAL_LOG_DEBUG("footprint: rss %ld kB (%+ld), hwm %ld kB, data %ld kB (%+ld), faults %lu minor %lu major, fds %ld (%+ld), threads %ld (%+ld)",
+                  after.rssKb, growth.rssKb, after.hwmKb, after.dataKb, growth.dataKb, after.minorFaults - gBefore.minorFaults,
+                  after.majorFaults - gBefore.majorFaults, after.fds, growth.fds, after.threads, growth.threads);
+
+    if (!hal_fixture_repeating())
+    {
+        if (!grew(&growth))
+        {
+            return;
+        }
+        /* Fail mode judges growth only once the test has run again, past any lazy initialisation in the HAL */
+        if (gMode == MODE_FAIL)
+        {
+            gFirst = growth;
+            hal_fixture_repeat();
+            return;
+        }
+        HAL_LOG_ERROR("footprint: %s left rss %+ld kB, data %+ld kB, fds %+ld, threads %+ld",
+                      test, growth.rssKb, growth.dataKb, growth.fds, growth.threads);
+        flag(test, &growth, GROWTH_SINGLE_RUN);
+        return;
+    }
+
+    if (!grew(&growth))
+    {
+        UT_LOG("footprint: %s left rss %+ld kB, data %+ld kB, fds %+ld, threads %+ld on its first run only, taken as one-time initialisation",
+               test, gFirst.rssKb, gFirst.dataKb, gFirst.fds, gFirst.threads);
+        flag(test, &gFirst, GROWTH_FIRST_RUN);
+        return;
+    }
+    HAL_LOG_ERROR("footprint: %s left rss %+ld kB, data %+ld kB, fds %+ld, threads %+ld, and rss %+ld kB, data %+ld kB, fds %+ld, threads %+ld when run again",
+                  test, gFirst.rssKb, gFirst.dataKb, gFirst.fds, gFirst.threads,
+                  growth.rssKb, growth.dataKb, growth.fds, growth.threads);
+    flag(test, &growth, GROWTH_EVERY_RUN);
+    if (growth.fds > 0 || growth.threads > 0)
+    {
+        UT_FAIL("Test left file descriptors or threads behind on every run");
+    }
+}
+
+static void print_table(const char *title, growth_kind_t kind)
+{
+    int i;
+
+    if (gFlaggedTotal[kind] == 0)
+    {
+        return;
+    }
+    printf("\n%s\n", title);
+    printf("%-56s %10s %10s %6s %8s\n", "test", "rss kB", "data kB", "fds", "threads");
+    for (i = 0; i < gFlaggedCount; i++)
+    {
+        if (gFlagged[i].kind == kind)
+        {
+            printf("%-56s %+10ld %+10ld %+6ld %+8ld\n", gFlagged[i].test, gFlagged[i].rssKb, gFlagged[i].dataKb,
+                   gFlagged[i].fds, gFlagged[i].threads);
+        }
+    }
+}
+
+static void print_summary(void)
+{
+    int total = gFlaggedTotal[GROWTH_SINGLE_RUN] + gFlaggedTotal[GROWTH_EVERY_RUN] + gFlaggedTotal[GROWTH_FIRST_RUN];
+
+    print_table("Tests that grew the process footprint", GROWTH_SINGLE_RUN);
+    print_table("Tests that grew the process footprint on every run", GROWTH_EVERY_RUN);
+    print_table("Tests that grew the process footprint on their first run only (one-time initialisation)", GROWTH_FIRST_RUN);
+    if (total > gFlaggedCount)
+    {
+        printf("... and %d more\n", total - gFlaggedCount);
+    }
+}
+
+static const hal_fixture_hook_t gFootprintHook =
+{
+    .name = "footprint",
+    .before = footprint_before,
+    .after = footprint_after,
+};
+
+int hal_footprint_init(void)
+{
+    const char *mode = getenv(HAL_FOOTPRINT_ENV);
+    const char *slack = getenv(HAL_FOOTPRINT_SLACK_ENV);
+    char *end = NULL;
+
+    if (mode != NULL && *mode != '\0')
+    {
+        if (!strcmp(mode, "off"))
+        {
+            gMode = MODE_OFF;
+        }
+        else if (!strcmp(mode, "report"))
+        {
+            gMode = MODE_REPORT;
+        }
+        else if (!strcmp(mode, "fail"))
+        {
+            gMode = MODE_FAIL;
+        }
+        else
+        {
+            printf("%s must be report, fail or off\n", HAL_FOOTPRINT_ENV);
+            return -1;
+        }
+    }
+    if (slack != NULL && *slack != '\0')
+    {
+        gSlackKb = strtol(slack, &end, 10);
+        if (*end != '\0' || gSlackKb < 0)
+        {
+            printf("%s must be a number of KiB\n", HAL_FOOTPRINT_SLACK_ENV);
+            return -1;
+        }
+    }
+    if (gMode == MODE_OFF)
+    {
+        return 0;
+    }
+    atexit(print_summary);
+    return hal_fixture_register(&gFootprintHook);
+}
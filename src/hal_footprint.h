@@ -0,0 +1,82 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+* @file hal_footprint.h
+* @brief Process resources sampled around every test.
+*
+* Before and after each test the per test hooks read from /proc/self the resident set size
+* and its high-water mark, the data segment (heap and anonymous mappings), the minor and
+* major page faults, the open file descriptors and the threads. Each test logs what it
+* changed at debug level. A test that leaves more file descriptors or threads open than it
+* found, or grows the resident set or data segment by more than the slack, is flagged and
+* listed when the suite exits. This catches a HAL that opens an fd per call or starts a
+* thread it never stops.
+*
+* In fail mode a flagged test is run once more (hal_fixture_repeat()), setters and
+* assertions included. Growth that repeats is flagged as a leak and fails the test when it
+* is in file descriptors or threads; growth on the first run only is taken as one-time
+* initialisation in the HAL, such as a file opened on first use and kept, and is listed
+* apart. Report mode never runs a test twice, so it cannot tell the two apart.
+*
+* PLATFORM_HAL_FOOTPRINT selects the mode:
+*
+* | value  | meaning                                                                    |
+* | ------ | -------------------------------------------------------------------------- |
+* | report | Flag growth in the log and the exit summary (default)                      |
+* | fail   | Run flagged tests again, failing those that leak fds or threads twice      |
+* | off    | Do not sample                                                              |
+*
+* PLATFORM_HAL_FOOTPRINT_SLACK sets the memory growth in KiB tolerated per test, default 256.
+*/
+
+#ifndef __HAL_FOOTPRINT_H__
+#define __HAL_FOOTPRINT_H__
+
+#define HAL_FOOTPRINT_ENV       "PLATFORM_HAL_FOOTPRINT"
+#define HAL_FOOTPRINT_SLACK_ENV "PLATFORM_HAL_FOOTPRINT_SLACK"
+
+#define HAL_FOOTPRINT_DEFAULT_SLACK_KB (256)
+
+/**
+* @brief Resources of the process at one point in time.
+*/
+typedef struct
+{
+    long          rssKb;
+    long          hwmKb;
+    long          dataKb;
+    unsigned long minorFaults;
+    unsigned long majorFaults;
+    long          fds;
+    long          threads;
+} hal_footprint_t;
+
+/**
+* @brief Read the configuration and register the sampling with the per test hooks.
+*
+* @return 0 on success, -1 on an invalid configuration
+*/
+int hal_footprint_init(void);
+
+/**
+* @brief Sample the resources of the process now, without allocating.
+*/
+void hal_footprint_sample(hal_footprint_t *footprint);
+
+#endif /* __HAL_FOOTPRINT_H__ */
@@ -0,0 +1,313 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+* @file hal_heap.c
+* @brief malloc family replacement attributing heap use to the active HAL API, see hal_heap.h.
+*/
+
+#if defined(HAL_INTERPOSE) && defined(HAL_HEAP)
+
+#include <ut_log.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/mman.h>
+#include "hal_interpose.h"
+#include "hal_heap.h"
+#include "hal_log.h"
+
+#define SLOT_MASK  (HAL_HEAP_SLOTS - 1)
+#define SLOT_LIMIT (HAL_HEAP_SLOTS / 4 * 3)
+
+extern void *__libc_malloc(size_t size);
+extern void *__libc_calloc(size_t count, size_t size);
+extern void *__libc_realloc(void *ptr, size_t size);
+extern void __libc_free(void *ptr);
+
+typedef struct
+{
+    void        *ptr;
+    size_t       size;
+    uint64_t     call;   /**< Call that made the allocation */
+    hal_api_id_t api;
+} heap_entry_t;
+
+typedef struct
+{
+    unsigned long      calls;
+    unsigned long      allocs;
+    unsigned long      frees;
+    unsigned long long bytes;
+    unsigned long long live;
+    unsigned long long peak;
+    unsigned long long retained;   /**< Sum over calls of the bytes still live when they returned */
+} heap_stats_t;
+
+/* Open addressing table of the attributed allocations, with linear probing and backward shift deletion */
+static heap_entry_t *gTable = NULL;
+static unsigned long gEntries = 0;
+static unsigned long gUntracked = 0;
+static heap_stats_t gStats[HAL_API_COUNT];
+static char gLock = 0;
+static uint64_t gNextCall = 0;
+
+static __thread int gActive = 0;
+static __thread hal_api_id_t gApi;
+static __thread uint64_t gCall;
+static __thread unsigned long long gCallLive;
+
+static void heap_lock(void)
+{
+    while (__atomic_test_and_set(&gLock, __ATOMIC_ACQUIRE))
+    {
+    }
+}
+
+static void heap_unlock(void)
+{
+    __atomic_clear(&gLock, __ATOMIC_RELEASE);
+}
+
+static unsigned long slot_of(const void *ptr)
+{
+    return (unsigned long)((((uint64_t)(uintptr_t)ptr >> 4) * 0x9E3779B97F4A7C15ull) >> 32) & SLOT_MASK;
+}
+
+/* Called with the lock held */
+static void insert(void *ptr, size_t size, hal_api_id_t api, uint64_t call)
+{
+    heap_stats_t *stats = &gStats[api];
+    unsigned long i;
+
+    if (gEntries >= SLOT_LIMIT)
+    {
+        gUntracked++;
+        return;
+    }
+    for (i = slot_of(ptr); gTable[i].ptr != NULL; i = (i + 1) & SLOT_MASK)
+    {
+    }
+    gTable[i].ptr = ptr;
+    gTable[i].size = size;
+    gTable[i].call = call;
+    gTable[i].api = api;
+    gEntries++;
+
+    stats->allocs++;
+    stats->bytes += size;
+    stats->live += size;
+    if (stats->live > stats->peak)
+    {
+        stats->peak = stats->live;
+    }
+}
+
+/* Called with the lock held */
+static int remove_entry(const void *ptr, heap_entry_t *entry)
+{
+    unsigned long i;
+    unsigned long j;
+    unsigned long home;
+
+    for (i = slot_of(ptr); gTable[i].ptr != ptr; i = (i + 1) & SLOT_MASK)
+    {
+        if (gTable[i].ptr == NULL)
+        {
+            return 0;
+        }
+    }
+    *entry = gTable[i];
+    gEntries--;
+    gStats[entry->api].frees++;
+    gStats[entry->api].live -= entry->size;
+
+    /* Move back any entry of the probe sequence that would no longer be reachable */
+    for (j = (i + 1) & SLOT_MASK; gTable[j].ptr != NULL; j = (j + 1) & SLOT_MASK)
+    {
+        home = slot_of(gTable[j].ptr);
+        if (((j - home) & SLOT_MASK) >= ((j - i) & SLOT_MASK))
+        {
+            gTable[i] = gTable[j];
+            i = j;
+        }
+    }
+    gTable[i].ptr = NULL;
+    return 1;
+}
+
+static void track(void *ptr, size_t size)
+{
+    if (ptr == NULL || !gActive || gTable == NULL)
+    {
+        return;
+    }
+    heap_lock();
+    insert(ptr, size, gApi, gCall);
+    heap_unlock();
+    gCallLive += size;
+}
+
+static int untrack(const void *ptr, heap_entry_t *entry)
+{
+    int found;
+
+    if (ptr == NULL || __atomic_load_n(&gEntries, __ATOMIC_RELAXED) == 0)
+    {
+        return 0;
+    }
+    heap_lock();
+    found = remove_entry(ptr, entry);
+    heap_unlock();
+    if (found && gActive && entry->call == gCall)
+    {
+        gCallLive -= entry->size;
+    }
+    return found;
+}
+
+void *malloc(size_t size)
+{
+    void *ptr = __libc_malloc(size);
+
+    track(ptr, size);
+    return ptr;
+}
+
+void *calloc(size_t count, size_t size)
+{
+    void *ptr = __libc_calloc(count, size);
+
+    /* __libc_calloc has already rejected an overflowing count * size */
+    track(ptr, count * size);
+    return ptr;
+}
+
+void *realloc(void *ptr, size_t size)
+{
+    heap_entry_t entry;
+    void *result;
+    int found;
+
+    if (ptr == NULL)
+    {
+        return malloc(size);
+    }
+    found = untrack(ptr, &entry);
+    result = __libc_realloc(ptr, size);
+    if (!found)
+    {
+        track(result, size);
+        return result;
+    }
+
+    /* The block keeps the API that allocated it, even when resized outside a call. A failed
+       realloc leaves the original block in place */
+    if (result != NULL || size != 0)
+    {
+        void *block = (result != NULL) ? result : ptr;
+        size_t length = (result != NULL) ? size : entry.size;
+
+        heap_lock();
+        insert(block, length, entry.api, entry.call);
+        heap_unlock();
+        if (gActive && entry.call == gCall)
+        {
+            gCallLive += length;
+        }
+    }
+    return result;
+}
+
+void free(void *ptr)
+{
+    heap_entry_t entry;
+
+    (void)untrack(ptr, &entry);
+    __libc_free(ptr);
+}
+
+static void heap_begin(hal_call_t *call)
+{
+    gApi = call->id;
+    gCall = __atomic_add_fetch(&gNextCall, 1, __ATOMIC_RELAXED);
+    gCallLive = 0;
+    gActive = 1;
+}
+
+static void heap_end(hal_call_t *call)
+{
+    (void)call;
+    if (!gActive)
+    {
+        return;
+    }
+    gActive = 0;
+    heap_lock();
+    gStats[gApi].calls++;
+    gStats[gApi].retained += gCallLive;
+    heap_unlock();
+}
+
+static void print_summary(void)
+{
+    int i;
+
+    printf("\nHeap use per API (bytes)\n");
+    printf("%-32s %8s %8s %10s %10s %10s %10s\n", "api", "calls", "allocs", "allocated", "returned", "peak", "leaked");
+    for (i = 0; i < HAL_API_COUNT; i++)
+    {
+        const heap_stats_t *stats = &gStats[i];
+
+        if (stats->allocs == 0)
+        {
+            continue;
+        }
+        printf("%-32s %8lu %8lu %10llu %10llu %10llu %10llu\n", hal_interpose_api_name((hal_api_id_t)i),
+               stats->calls, stats->allocs, stats->bytes, stats->retained, stats->peak, stats->live);
+    }
+    if (gUntracked != 0)
+    {
+        printf("%lu allocations were not attributed, the table of %d entries was full\n", gUntracked, HAL_HEAP_SLOTS);
+    }
+}
+
+static const hal_interpose_hook_t gHeapHook =
+{
+    .name = "heap",
+    .begin = heap_begin,
+    .end = heap_end,
+};
+
+int hal_heap_init(void)
+{
+    void *table = mmap(NULL, HAL_HEAP_SLOTS * sizeof(heap_entry_t), PROT_READ | PROT_WRITE,
+                       MAP_PRIVATE | MAP_ANONYMOUS, -1, 0);
+
+    if (table == MAP_FAILED)
+    {
+        return -1;
+    }
+    gTable = table;
+    UT_LOG("heap attribution enabled for %d live allocations", HAL_HEAP_SLOTS / 4 * 3);
+    atexit(print_summary);
+    return hal_interpose_register(&gHeapHook);
+}
+
+#endif /* HAL_INTERPOSE && HAL_HEAP */
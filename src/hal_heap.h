@@ -0,0 +1,51 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+* @file hal_heap.h
+* @brief Heap use of each platform_hal_* API, measured on top of the HAL interposer.
+*
+* Built with "make INTERPOSE=1 HEAP=1" (HAL_HEAP) the suite replaces malloc, calloc, realloc
+* and free. Every allocation made on a thread while a platform_hal_* call is active on it,
+* by the HAL or by anything the HAL calls, is recorded against that API, and a later free
+* or realloc of it is credited back to the same API wherever it happens. This covers the
+* vendor libhal_platform as well as the Linux skeleton, since the executable's definitions
+* take precedence over the C library's for shared libraries too.
+*
+* When the suite exits a table lists per API the calls, allocations and bytes allocated, the
+* bytes still live when calls returned (memory handed to the caller or kept by the HAL), the
+* peak of live bytes and the bytes never freed. Allocations made by threads the HAL starts
+* and the memalign family are not attributed.
+*
+* The replacement forwards to glibc's __libc_malloc family and cannot be combined with
+* AddressSanitizer or other allocator replacements.
+*/
+
+#ifndef __HAL_HEAP_H__
+#define __HAL_HEAP_H__
+
+#define HAL_HEAP_SLOTS (65536)   /**< Attributed allocations live at the same time */
+
+/**
+* @brief Start attributing allocations and register the heap hook with the interposer.
+*
+* @return 0 on success, -1 on error
+*/
+int hal_heap_init(void);
+
+#endif /* __HAL_HEAP_H__ */
@@ -0,0 +1,146 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+* @file hal_interpose.c
+* @brief Generated __wrap_platform_hal_* functions and the hook chain behind them.
+*
+* Only built into the suite with "make INTERPOSE=1", see hal_interpose.h.
+*/
+
+#ifdef HAL_INTERPOSE
+
+#include <string.h>
+#include <time.h>
+#include "hal_interpose.h"
+
+#define HAL_INTERPOSE_MAX_HOOKS (8)
+
+static const hal_interpose_hook_t *gHooks[HAL_INTERPOSE_MAX_HOOKS];
+static int gHookCount = 0;
+
+static const char *const gApiNames[HAL_API_COUNT] =
+{
+#define HAL_API(kind, type, name, params, forward, ...) #name,
+#include "hal_api.def"
+#undef HAL_API
+};
+
+int hal_interpose_register(const hal_interpose_hook_t *hook)
+{
+    if (hook == NULL || gHookCount >= HAL_INTERPOSE_MAX_HOOKS)
+    {
+        return -1;
+    }
+    gHooks[gHookCount++] = hook;
+    return 0;
+}
+
+const char *hal_interpose_api_name(hal_api_id_t id)
+{
+    return (id < HAL_API_COUNT) ? gApiNames[id] : "unknown";
+}
+
+hal_api_id_t hal_interpose_find_api(const char *name)
+{
+    int i;
+
+    if (name == NULL)
+    {
+        return HAL_API_COUNT;
+    }
+    if (!strncmp(name, "platform_hal_", strlen("platform_hal_")))
+    {
+        name += strlen("platform_hal_");
+    }
+    for (i = 0; i < HAL_API_COUNT; i++)
+    {
+        if (!strcmp(gApiNames[i], name))
+        {
+            return (hal_api_id_t)i;
+        }
+    }
+    return HAL_API_COUNT;
+}
+
+uint64_t hal_interpose_now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * 1000000000ull + (uint64_t)ts.tv_nsec;
+}
+
+void hal_interpose_begin(hal_call_t *call)
+{
+    int i;
+
+    if (call->argCount == 1 && call->args[0].kind == HAL_ARG_KIND_NONE)
+    {
+        call->argCount = 0;
+    }
+    call->startNs = hal_interpose_now_ns();
+    for (i = 0; i < gHookCount && !call->skip; i++)
+    {
+        if (gHooks[i]->begin != NULL)
+        {
+            gHooks[i]->begin(call);
+        }
+    }
+}
+
+void hal_interpose_end(hal_call_t *call)
+{
+    int i;
+
+    call->endNs = hal_interpose_now_ns();
+    for (i = gHookCount - 1; i >= 0; i--)
+    {
+        if (gHooks[i]->end != NULL)
+        {
+            gHooks[i]->end(call);
+        }
+    }
+}
+
+#define HAL_API(kind, type, name, params, forward, ...)                              \
+    extern type __real_platform_hal_##name params;                                  \
+    type __wrap_platform_hal_##name params;                                         \
+    type __wrap_platform_hal_##name params                                          \
+    {                                                                               \
+        hal_arg_t halArgs[] = { __VA_ARGS__ };                                      \
+        hal_call_t call;                                                            \
+                                                                                    \
+        memset(&call, 0, sizeof(call));                                             \
+        call.id = HAL_API_ID_##name;                                                \
+        call.api = #name;                                                           \
+        call.retKind = kind;                                                        \
+        call.args = halArgs;                                                        \
+        call.argCount = (int)(sizeof(halArgs) / sizeof(halArgs[0]));                \
+        hal_interpose_begin(&call);                                                 \
+        if (!call.skip)                                                             \
+        {                                                                           \
+            call.ret = (long long)__real_platform_hal_##name forward;               \
+        }                                                                           \
+        hal_interpose_end(&call);                                                   \
+        return (type)call.ret;                                                      \
+    }
+#include "hal_api.def"
+#undef HAL_API
+
+#endif /* HAL_INTERPOSE */
@@ -0,0 +1,154 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+* @file hal_interpose.h
+* @brief Link time interposer around every platform_hal_* API.
+*
+* When the suite is built with "make INTERPOSE=1" the Makefile adds HAL_INTERPOSE to CFLAGS
+* and links with -Wl,--wrap=platform_hal_<api> for every entry of hal_api.def, so each call
+* made by the tests lands in a generated __wrap_ function. The wrapper describes the call
+* (API, arguments and output buffers) in a hal_call_t and passes it through the registered
+* hooks before and after invoking the real implementation. This works the same whether the
+* real implementation is the Linux skeleton or the vendor libhal_platform.
+*/
+
+#ifndef __HAL_INTERPOSE_H__
+#define __HAL_INTERPOSE_H__
+
+#include <stdint.h>
+#include <stddef.h>
+#include "platform_hal.h"
+
+/**
+* @brief How the result of an API is interpreted.
+*/
+typedef enum
+{
+    HAL_RET_STATUS = 0,   /**< RETURN_OK or RETURN_ERR */
+    HAL_RET_VALUE         /**< The result is the value itself, e.g. getFanSpeed */
+} hal_ret_kind_t;
+
+/**
+* @brief Kind of an API parameter.
+*/
+typedef enum
+{
+    HAL_ARG_KIND_NONE = 0,      /**< API without parameters */
+    HAL_ARG_KIND_VALUE,         /**< Scalar passed by value */
+    HAL_ARG_KIND_STR_IN,        /**< NUL terminated input string */
+    HAL_ARG_KIND_MEM_IN,        /**< Input structure of a fixed size */
+    HAL_ARG_KIND_STR_OUT,       /**< NUL terminated output buffer */
+    HAL_ARG_KIND_MEM_OUT,       /**< Output structure of a fixed size */
+    HAL_ARG_KIND_MEM_OUT_REF,   /**< Pointer to a caller allocated output structure */
+    HAL_ARG_KIND_DHCP_OUT       /**< dhcp_opt_list allocated by the HAL */
+} hal_arg_kind_t;
+
+/**
+* @brief Description of one API parameter.
+*/
+typedef struct
+{
+    hal_arg_kind_t kind;
+    const char    *name;
+    void          *ptr;     /**< Buffer for the pointer kinds */
+    size_t         size;    /**< Size of the buffer for the MEM kinds */
+    long long      value;   /**< Value for HAL_ARG_KIND_VALUE */
+} hal_arg_t;
+
+#define HAL_ARG_VALUE(x)              { HAL_ARG_KIND_VALUE, #x, NULL, 0, (long long)(x) }
+#define HAL_ARG_STR_IN(p)             { HAL_ARG_KIND_STR_IN, #p, (void *)(p), 0, 0 }
+#define HAL_ARG_MEM_IN(p, type)       { HAL_ARG_KIND_MEM_IN, #p, (void *)(p), sizeof(type), 0 }
+#define HAL_ARG_STR_OUT(p)            { HAL_ARG_KIND_STR_OUT, #p, (void *)(p), 0, 0 }
+#define HAL_ARG_MEM_OUT(p, type)      { HAL_ARG_KIND_MEM_OUT, #p, (void *)(p), sizeof(type), 0 }
+#define HAL_ARG_MEM_OUT_REF(pp, type) { HAL_ARG_KIND_MEM_OUT_REF, #pp, (void *)(pp), sizeof(type), 0 }
+#define HAL_ARG_DHCP_OUT(pp)          { HAL_ARG_KIND_DHCP_OUT, #pp, (void *)(pp), 0, 0 }
+#define HAL_NO_ARGS                   { HAL_ARG_KIND_NONE, NULL, NULL, 0, 0 }
+
+/**
+* @brief Identifier of every API in hal_api.def.
+*/
+typedef enum
+{
+#define HAL_API(kind, type, name, params, forward, ...) HAL_API_ID_##name,
+#include "hal_api.def"
+#undef HAL_API
+    HAL_API_COUNT
+} hal_api_id_t;
+
+/**
+* @brief One call travelling through the interposer.
+*/
+typedef struct
+{
+    hal_api_id_t   id;
+    const char    *api;        /**< Name without the platform_hal_ prefix */
+    hal_ret_kind_t retKind;
+    hal_arg_t     *args;
+    int            argCount;
+    long long      ret;        /**< Result, valid in the end hooks */
+    int            skip;       /**< Set by a begin hook that supplied ret itself */
+    uint64_t       startNs;    /**< CLOCK_MONOTONIC before the begin hooks */
+    uint64_t       endNs;      /**< CLOCK_MONOTONIC after the real call */
+} hal_call_t;
+
+/**
+* @brief A layer of the interposer.
+*
+* Begin hooks run in registration order before the real call. A hook that sets
+* call->skip and call->ret replaces the real call, and the remaining begin hooks are
+* not run. End hooks run in reverse order after the real call.
+*/
+typedef struct
+{
+    const char *name;
+    void (*begin)(hal_call_t *call);
+    void (*end)(hal_call_t *call);
+} hal_interpose_hook_t;
+
+/**
+* @brief Register a hook. Must be called before the tests start.
+*
+* @return 0 on success, -1 if the hook table is full
+*/
+int hal_interpose_register(const hal_interpose_hook_t *hook);
+
+/**
+* @brief Return the name of an API without the platform_hal_ prefix.
+*/
+const char *hal_interpose_api_name(hal_api_id_t id);
+
+/**
+* @brief Find an API by name, with or without the platform_hal_ prefix.
+*
+* @return The API identifier, or HAL_API_COUNT if the name is unknown
+*/
+hal_api_id_t hal_interpose_find_api(const char *name);
+
+/**
+* @brief Return the monotonic time in nanoseconds used for call timestamps.
+*/
+uint64_t hal_interpose_now_ns(void);
+
+/**
+* @brief Called by the generated wrappers, not by the hooks.
+*/
+void hal_interpose_begin(hal_call_t *call);
+void hal_interpose_end(hal_call_t *call);
+
+#endif /* __HAL_INTERPOSE_H__ */
@@ -0,0 +1,350 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+* @file hal_log.c
+* @brief Asynchronous UT_LOG backend, see hal_log.h.
+*
+* Each logging thread owns a single producer, single consumer ring of variable length
+* records. A record holds the call site, the format pointer, a global sequence number and
+* the arguments as captured by hal_log_capture(), which the background thread renders.
+*/
+
+#ifdef HAL_LOG_ASYNC
+
+#include <pthread.h>
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "hal_log.h"
+#include "hal_log_format.h"
+
+#define LOG_RING_DEFAULT  (256 * 1024)
+#define LOG_RING_MIN      (64 * 1024)
+#define LOG_RING_MAX      (1 << 30)
+#define LOG_MESSAGE_MAX   (4096)         /* formatted length of one message */
+#define LOG_IDLE_NS       (1000000)      /* background thread poll interval when the rings are empty */
+#define LOG_WAIT_NS       (50000)        /* retry interval of a caller waiting for room */
+
+#define ALIGN8(n)         (((size_t)(n) + 7) & ~(size_t)7)
+#define RECORD_HEADER     ALIGN8(sizeof(log_record_t))
+
+typedef struct
+{
+    uint32_t size;              /* bytes including this header, 0 pads to the end of the ring */
+    uint32_t line;
+    uint64_t seq;
+    const char *file;
+    const char *format;
+} log_record_t;
+
+typedef struct log_ring
+{
+    uint64_t head;              /* read position, advanced by the background thread */
+    uint8_t padHead[56];
+    uint64_t tail;              /* write position, advanced by the owning thread */
+    uint64_t dropped;           /* messages the owning thread discarded */
+    uint8_t padTail[48];
+    uint64_t reported;          /* discarded messages already reported */
+    int owned;                  /* 1 while a thread logs into the ring */
+    uint8_t *data;
+    struct log_ring *next;
+} log_ring_t;
+
+static log_ring_t *gRings = NULL;                   /* every ring created, newest first */
+static pthread_mutex_t gRingLock = PTHREAD_MUTEX_INITIALIZER;
+static pthread_key_t gRingKey;
+static __thread log_ring_t *tRing = NULL;
+static size_t gRingSize = LOG_RING_DEFAULT;
+static int gDrop = 0;
+static int gRunning = 0;
+static int gStop = 0;
+static uint64_t gSeq = 0;
+static pthread_t gThread;
+
+static void pause_ns(long ns)
+{
+    struct timespec ts = { 0, ns };
+
+    nanosleep(&ts, NULL);
+}
+
+static void write_message(const char *file, int line, const char *format, const uint8_t *payload, size_t length)
+{
+    char message[LOG_MESSAGE_MAX];
+
+    hal_log_render(message, sizeof(message), format, payload, length);
+    UT_logPrefix(file, line, UT_LOG_PREFIX, "%s", message);
+}
+
+static void release_ring(void *ring)
+{
+    __atomic_store_n(&((log_ring_t *)ring)->owned, 0, __ATOMIC_RELEASE);
+}
+
+/* The calling thread's ring, reusing one left by a thread that has exited */
+static log_ring_t *get_ring(void)
+{
+    log_ring_t *ring;
+
+    if (tRing != NULL)
+    {
+        return tRing;
+    }
+    pthread_mutex_lock(&gRingLock);
+    for (ring = gRings; ring != NULL; ring = ring->next)
+    {
+        int expected = 0;
+
+        if (__atomic_compare_exchange_n(&ring->owned, &expected, 1, 0, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED))
+        {
+            break;
+        }
+    }
+    if (ring == NULL && posix_memalign((void **)&ring, 64, sizeof(*ring)) == 0)
+    {
+        memset(ring, 0, sizeof(*ring));
+        ring->owned = 1;
+        ring->data = (uint8_t *)malloc(gRingSize);
+        if (ring->data == NULL)
+        {
+            free(ring);
+            ring = NULL;
+        }
+        else
+        {
+            ring->next = gRings;
+            __atomic_store_n(&gRings, ring, __ATOMIC_RELEASE);
+        }
+    }
+    pthread_mutex_unlock(&gRingLock);
+    if (ring != NULL)
+    {
+        pthread_setspecific(gRingKey, ring);
+        tRing = ring;
+    }
+    return ring;
+}
+
+static int ring_put(log_ring_t *ring, const char *file, int line, const char *format, const uint8_t *payload, size_t length)
+{
+    size_t need = RECORD_HEADER + ALIGN8(length);
+    uint64_t tail = __atomic_load_n(&ring->tail, __ATOMIC_RELAXED);
+    uint64_t head = __atomic_load_n(&ring->head, __ATOMIC_ACQUIRE);
+    size_t offset = (size_t)(tail & (gRingSize - 1));
+    size_t skip = (gRingSize - offset < need) ? gRingSize - offset : 0;
+    log_record_t *record;
+
+    if (tail + skip + need - head > gRingSize)
+    {
+        return 0;
+    }
+    if (skip != 0)
+    {
+        *(uint32_t *)(ring->data + offset) = 0;
+        tail += skip;
+        offset = 0;
+    }
+    record = (log_record_t *)(ring->data + offset);
+    record->size = (uint32_t)need;
+    record->line = (uint32_t)line;
+    record->seq = __atomic_fetch_add(&gSeq, 1, __ATOMIC_RELAXED);
+    record->file = file;
+    record->format = format;
+    memcpy(ring->data + offset + RECORD_HEADER, payload, length);
+    __atomic_store_n(&ring->tail, tail + need, __ATOMIC_RELEASE);
+    return 1;
+}
+
+void hal_log_async(const char *file, int line, const char *format, ...)
+{
+    uint8_t payload[HAL_LOG_PAYLOAD_MAX];
+    log_ring_t *ring = NULL;
+    size_t length;
+    va_list ap;
+
+    va_start(ap, format);
+    length = hal_log_capture(payload, format, &ap);
+    va_end(ap);
+    if (__atomic_load_n(&gRunning, __ATOMIC_ACQUIRE))
+    {
+        ring = get_ring();
+    }
+    while (ring != NULL && !ring_put(ring, file, line, format, payload, length))
+    {
+        if (gDrop)
+        {
+            __atomic_add_fetch(&ring->dropped, 1, __ATOMIC_RELAXED);
+            return;
+        }
+        if (!__atomic_load_n(&gRunning, __ATOMIC_ACQUIRE))
+        {
+            ring = NULL;
+            break;
+        }
+        pause_ns(LOG_WAIT_NS);
+    }
+    if (ring == NULL)
+    {
+        write_message(file, line, format, payload, length);
+    }
+}
+
+/* The next record of a ring, skipping padding */
+static log_record_t *ring_peek(log_ring_t *ring)
+{
+    uint64_t tail = __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE);
+    uint64_t head = ring->head;
+
+    while (head != tail)
+    {
+        size_t offset = (size_t)(head & (gRingSize - 1));
+        log_record_t *record = (log_record_t *)(ring->data + offset);
+
+        if (record->size != 0)
+        {
+            return record;
+        }
+        head += gRingSize - offset;
+        __atomic_store_n(&ring->head, head, __ATOMIC_RELEASE);
+    }
+    return NULL;
+}
+
+/* Writes everything queued, oldest first across the rings, and returns the number of messages written */
+static int drain(void)
+{
+    int written = 0;
+
+    for (;;)
+    {
+        log_ring_t *ring;
+        log_ring_t *oldest = NULL;
+        log_record_t *next = NULL;
+
+        for (ring = __atomic_load_n(&gRings, __ATOMIC_ACQUIRE); ring != NULL; ring = ring->next)
+        {
+            uint64_t dropped = __atomic_load_n(&ring->dropped, __ATOMIC_RELAXED);
+            log_record_t *record;
+
+            if (dropped != ring->reported)
+            {
+                UT_logPrefix(__FILE__, __LINE__, UT_LOG_PREFIX, "%llu log messages dropped, ring full",
+                             (unsigned long long)(dropped - ring->reported));
+                ring->reported = dropped;
+            }
+            record = ring_peek(ring);
+            if (record != NULL && (next == NULL || record->seq < next->seq))
+            {
+                oldest = ring;
+                next = record;
+            }
+        }
+        if (next == NULL)
+        {
+            return written;
+        }
+        write_message(next->file, (int)next->line, next->format, (const uint8_t *)next + RECORD_HEADER, next->size - RECORD_HEADER);
+        __atomic_store_n(&oldest->head, oldest->head + next->size, __ATOMIC_RELEASE);
+        written++;
+    }
+}
+
+static void *drain_thread(void *arg)
+{
+    (void)arg;
+    for (;;)
+    {
+        int stop = __atomic_load_n(&gStop, __ATOMIC_ACQUIRE);
+
+        if (drain() == 0)
+        {
+            if (stop)
+            {
+                break;
+            }
+            pause_ns(LOG_IDLE_NS);
+        }
+    }
+    return NULL;
+}
+
+static int pending(void)
+{
+    log_ring_t *ring;
+
+    for (ring = __atomic_load_n(&gRings, __ATOMIC_ACQUIRE); ring != NULL; ring = ring->next)
+    {
+        if (__atomic_load_n(&ring->head, __ATOMIC_ACQUIRE) != __atomic_load_n(&ring->tail, __ATOMIC_ACQUIRE))
+        {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+void hal_log_flush(void)
+{
+    while (__atomic_load_n(&gRunning, __ATOMIC_ACQUIRE) && pending())
+    {
+        pause_ns(LOG_WAIT_NS);
+    }
+}
+
+static void stop_logging(void)
+{
+    __atomic_store_n(&gRunning, 0, __ATOMIC_RELEASE);
+    __atomic_store_n(&gStop, 1, __ATOMIC_RELEASE);
+    pthread_join(gThread, NULL);
+}
+
+int hal_log_init(void)
+{
+    const char *ring = getenv(HAL_LOG_RING_ENV);
+    const char *overflow = getenv(HAL_LOG_OVERFLOW_ENV);
+
+    if (ring != NULL)
+    {
+        long long requested = atoll(ring);
+
+        gRingSize = LOG_RING_MIN;
+        while ((long long)gRingSize < requested && gRingSize < LOG_RING_MAX)
+        {
+            gRingSize <<= 1;
+        }
+    }
+    if (overflow != NULL && strcmp(overflow, "drop") != 0 && strcmp(overflow, "block") != 0)
+    {
+        printf("%s must be block or drop\n", HAL_LOG_OVERFLOW_ENV);
+        return -1;
+    }
+    gDrop = (overflow != NULL && strcmp(overflow, "drop") == 0);
+    if (pthread_key_create(&gRingKey, release_ring) != 0 || pthread_create(&gThread, NULL, drain_thread, NULL) != 0)
+    {
+        return -1;
+    }
+    __atomic_store_n(&gRunning, 1, __ATOMIC_RELEASE);
+    atexit(stop_logging);
+    return 0;
+}
+
+#endif /* HAL_LOG_ASYNC */
@@ -0,0 +1,170 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+* @file hal_log.h
+* @brief Log levels and alternative backends for UT_LOG.
+*
+* Messages have one of four levels: HAL_LOG_ERROR for the details of a failure, UT_LOG for
+* information about the run (info), HAL_LOG_DEBUG for the steps of each test and HAL_LOG_TRACE
+* for values that passed validation. Building with LOG_LEVEL=error|info|debug|trace
+* (HAL_LOG_LEVEL, default trace) compiles every message below that level out of the binary,
+* format string included; their arguments are still type checked but never evaluated.
+*
+* In builds made with LOG=async (HAL_LOG_ASYNC) UT_LOG no longer formats and writes on the
+* calling thread. The call copies the file, line, format pointer and the arguments the format
+* consumes, strings by value, into a lock-free ring owned by the calling thread. A background
+* thread takes the records from all rings in call order, formats them and passes them to
+* UT_logPrefix(). Formats must therefore be string literals, as every UT_LOG in the suite is.
+*
+* PLATFORM_HAL_LOG_RING=<bytes> sets the size of each ring (default 262144, rounded up to a power of two).
+* PLATFORM_HAL_LOG_OVERFLOW selects what a call finding its ring full does:
+*     block - wait for the background thread to make room (default, nothing is lost)
+*     drop  - discard the message; the number discarded is logged in its place
+*
+* A message appears when the background thread reaches it, so it can follow output printed
+* directly by the framework. hal_log_flush() waits for every queued message, and the rings are
+* flushed when the suite exits.
+*
+* In builds made with LOG=binary (HAL_LOG_BINARY) nothing is formatted on the device. Every
+* call site is a hal_log_site_t placed by the linker in the hal_log_sites section, so its
+* index there is a message ID fixed at build time. A call appends the ID, a timestamp and the
+* captured arguments to a memory mapped file, PLATFORM_HAL_LOG_FILE (default
+* platform_hal_test.hlog), which grows in chunks up to PLATFORM_HAL_LOG_SIZE bytes (default
+* 268435456); messages past that are counted as dropped. The file starts with the table of
+* call sites, so bin/hal_log_decode can turn it back into text or JSON on any host. The file
+* layout is described in hal_log_format.h.
+*/
+
+#ifndef __HAL_LOG_H__
+#define __HAL_LOG_H__
+
+#include <ut_log.h>
+
+#define HAL_LOG_RING_ENV      "PLATFORM_HAL_LOG_RING"
+#define HAL_LOG_OVERFLOW_ENV  "PLATFORM_HAL_LOG_OVERFLOW"
+#define HAL_LOG_FILE_ENV      "PLATFORM_HAL_LOG_FILE"
+#define HAL_LOG_SIZE_ENV      "PLATFORM_HAL_LOG_SIZE"
+
+#define HAL_LOG_LEVEL_ERROR   (0)
+#define HAL_LOG_LEVEL_INFO    (1)
+#define HAL_LOG_LEVEL_DEBUG   (2)
+#define HAL_LOG_LEVEL_TRACE   (3)
+
+#ifndef HAL_LOG_LEVEL
+#define HAL_LOG_LEVEL HAL_LOG_LEVEL_TRACE
+#endif
+
+#if defined(HAL_LOG_ASYNC) && defined(HAL_LOG_BINARY)
+#error LOG=async and LOG=binary cannot be combined
+#endif
+
+#if defined(HAL_LOG_ASYNC) || defined(HAL_LOG_BINARY)
+#define HAL_LOG_BACKEND
+
+/**
+* @brief Start the log backend according to the environment.
+*
+* Messages logged before this are formatted and written synchronously.
+*
+* @return 0 on success, -1 on error
+*/
+int hal_log_init(void);
+
+/**
+* @brief Wait until every message logged so far has been written.
+*/
+void hal_log_flush(void);
+#endif
+
+#if defined(HAL_LOG_ASYNC)
+
+/**
+* @brief Queue one message, see UT_LOG.
+*/
+void hal_log_async(const char *file, int line, const char *format, ...);
+
+#define HAL_LOG_WRITE(format, ...) hal_log_async(__FILE__, __LINE__, format, ## __VA_ARGS__)
+
+#elif defined(HAL_LOG_BINARY)
+
+/**
+* @brief One UT_LOG call site; its index in the hal_log_sites section is its message ID.
+*/
+typedef struct
+{
+    const char *file;
+    const char *format;
+    int line;
+} hal_log_site_t;
+
+/**
+* @brief Append one message to the binary log, see UT_LOG.
+*/
+void hal_log_binary(const hal_log_site_t *site, ...);
+
+#define HAL_LOG_WRITE(format, ...) \
+    do \
+    { \
+        static const hal_log_site_t logSite __attribute__((section("hal_log_sites"), aligned(sizeof(void *)))) = { __FILE__, format, __LINE__ }; \
+        hal_log_binary(&logSite, ## __VA_ARGS__); \
+    } while (0)
+
+#else
+#define HAL_LOG_WRITE(format, ...) UT_logPrefix(__FILE__, __LINE__, UT_LOG_PREFIX, format, ## __VA_ARGS__)
+#endif
+
+/* Keeps the arguments of a compiled out message type checked */
+static inline void hal_log_discard(const char *format, ...) __attribute__((format(printf, 1, 2)));
+static inline void hal_log_discard(const char *format, ...)
+{
+    (void)format;
+}
+
+/*
+* Levels are selected by the preprocessor rather than by a constant condition around
+* HAL_LOG_WRITE, so a compiled out message never instantiates a binary log site, even at -O0.
+* The constant false condition of HAL_LOG_OFF removes the call and its format string.
+*/
+#define HAL_LOG_ON(format, ...)  do { HAL_LOG_WRITE(format, ## __VA_ARGS__); } while (0)
+#define HAL_LOG_OFF(format, ...) do { if (0) { hal_log_discard(format, ## __VA_ARGS__); } } while (0)
+
+#if HAL_LOG_LEVEL >= HAL_LOG_LEVEL_ERROR
+#define HAL_LOG_ERROR(format, ...)  HAL_LOG_ON(format, ## __VA_ARGS__)
+#else
+#define HAL_LOG_ERROR(format, ...)  HAL_LOG_OFF(format, ## __VA_ARGS__)
+#endif
+#if HAL_LOG_LEVEL >= HAL_LOG_LEVEL_DEBUG
+#define HAL_LOG_DEBUG(format, ...)  HAL_LOG_ON(format, ## __VA_ARGS__)
+#else
+#define HAL_LOG_DEBUG(format, ...)  HAL_LOG_OFF(format, ## __VA_ARGS__)
+#endif
+#if HAL_LOG_LEVEL >= HAL_LOG_LEVEL_TRACE
+#define HAL_LOG_TRACE(format, ...)  HAL_LOG_ON(format, ## __VA_ARGS__)
+#else
+#define HAL_LOG_TRACE(format, ...)  HAL_LOG_OFF(format, ## __VA_ARGS__)
+#endif
+
+#undef UT_LOG
+#if HAL_LOG_LEVEL >= HAL_LOG_LEVEL_INFO
+#define UT_LOG(format, ...) HAL_LOG_ON(format, ## __VA_ARGS__)
+#else
+#define UT_LOG(format, ...) HAL_LOG_OFF(format, ## __VA_ARGS__)
+#endif
+
+#endif /* __HAL_LOG_H__ */
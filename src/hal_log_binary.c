@@ -0,0 +1,259 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+* @file hal_log_binary.c
+* @brief Binary UT_LOG backend writing to a memory mapped file, see hal_log.h.
+*
+* The write position is one 64 bit counter holding the chunk number above CURSOR_BITS and the
+* offset within it below, so a message is placed with a single atomic add. A message that
+* runs past the end of its chunk takes the lock, maps the next chunk if nobody has yet, and
+* tries again; the unused end of the old chunk stays zero, which the decoder skips. Chunks stay
+* mapped until exit so that slower writers can still finish their records.
+*/
+
+#ifdef HAL_LOG_BINARY
+
+#include <fcntl.h>
+#include <pthread.h>
+#include <stdarg.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include "hal_log.h"
+#include "hal_log_format.h"
+
+#define LOG_FILE_DEFAULT  "platform_hal_test.hlog"
+#define LOG_SIZE_DEFAULT  (256ULL << 20)
+#define LOG_CHUNK         (4U << 20)
+#define LOG_MESSAGE_MAX   (4096)
+#define CURSOR_BITS       (40)
+#define CURSOR_MASK       ((1ULL << CURSOR_BITS) - 1)
+
+#define ALIGN8(n)         (((size_t)(n) + 7) & ~(size_t)7)
+
+extern const hal_log_site_t __start_hal_log_sites[] __attribute__((weak));
+extern const hal_log_site_t __stop_hal_log_sites[] __attribute__((weak));
+
+static pthread_mutex_t gChunkLock = PTHREAD_MUTEX_INITIALIZER;
+static uint8_t **gChunks = NULL;        /* mapping of every chunk so far */
+static uint64_t gMaxChunks = 0;
+static uint64_t gCursor = 0;            /* chunk << CURSOR_BITS | offset of the next record */
+static uint64_t gDataOffset = 0;
+static uint64_t gDropped = 0;
+static int gFull = 0;                   /* set when the size limit is reached or at exit */
+static int gStopped = 0;
+static int gFd = -1;
+
+static void write_message(const hal_log_site_t *site, const uint8_t *payload, size_t length)
+{
+    char message[LOG_MESSAGE_MAX];
+
+    hal_log_render(message, sizeof(message), site->format, payload, length);
+    UT_logPrefix(site->file, site->line, UT_LOG_PREFIX, "%s", message);
+}
+
+/* Maps the chunk after the one a writer overran, unless another writer already has */
+static int next_chunk(uint64_t chunk)
+{
+    int ok = 1;
+
+    pthread_mutex_lock(&gChunkLock);
+    if (__atomic_load_n(&gFull, __ATOMIC_ACQUIRE))
+    {
+        ok = 0;
+    }
+    else if ((__atomic_load_n(&gCursor, __ATOMIC_ACQUIRE) >> CURSOR_BITS) == chunk)
+    {
+        uint64_t next = chunk + 1;
+        void *map = MAP_FAILED;
+
+        if (next < gMaxChunks && ftruncate(gFd, (off_t)(gDataOffset + (next + 1) * LOG_CHUNK)) == 0)
+        {
+            map = mmap(NULL, LOG_CHUNK, PROT_READ | PROT_WRITE, MAP_SHARED, gFd, (off_t)(gDataOffset + next * LOG_CHUNK));
+        }
+        if (map == MAP_FAILED)
+        {
+            __atomic_store_n(&gFull, 1, __ATOMIC_RELEASE);
+            ok = 0;
+        }
+        else
+        {
+            gChunks[next] = (uint8_t *)map;
+            __atomic_store_n(&gCursor, next << CURSOR_BITS, __ATOMIC_RELEASE);
+        }
+    }
+    pthread_mutex_unlock(&gChunkLock);
+    return ok;
+}
+
+void hal_log_binary(const hal_log_site_t *site, ...)
+{
+    uint8_t payload[HAL_LOG_PAYLOAD_MAX];
+    struct timespec now;
+    size_t length;
+    size_t need;
+    va_list ap;
+
+    va_start(ap, site);
+    length = hal_log_capture(payload, site->format, &ap);
+    va_end(ap);
+    if (gFd < 0 || __atomic_load_n(&gStopped, __ATOMIC_ACQUIRE))
+    {
+        write_message(site, payload, length);
+        return;
+    }
+    clock_gettime(CLOCK_REALTIME, &now);
+    need = sizeof(hal_log_record_t) + ALIGN8(length);
+    while (!__atomic_load_n(&gFull, __ATOMIC_ACQUIRE))
+    {
+        uint64_t cursor = __atomic_fetch_add(&gCursor, need, __ATOMIC_ACQUIRE);
+        uint64_t chunk = cursor >> CURSOR_BITS;
+        uint64_t offset = cursor & CURSOR_MASK;
+
+        if (offset + need <= LOG_CHUNK)
+        {
+            hal_log_record_t *record = (hal_log_record_t *)(gChunks[chunk] + offset);
+
+            record->size = (uint32_t)need;
+            record->id = (uint32_t)(site - __start_hal_log_sites);
+            record->timeNs = (uint64_t)now.tv_sec * 1000000000ULL + (uint64_t)now.tv_nsec;
+            memcpy(record + 1, payload, length);
+            return;
+        }
+        if (!next_chunk(chunk))
+        {
+            break;
+        }
+    }
+    __atomic_add_fetch(&gDropped, 1, __ATOMIC_RELAXED);
+}
+
+void hal_log_flush(void)
+{
+    uint64_t chunk;
+
+    pthread_mutex_lock(&gChunkLock);
+    for (chunk = 0; gFd >= 0 && chunk <= (__atomic_load_n(&gCursor, __ATOMIC_ACQUIRE) >> CURSOR_BITS); chunk++)
+    {
+        msync(gChunks[chunk], LOG_CHUNK, MS_ASYNC);
+    }
+    pthread_mutex_unlock(&gChunkLock);
+}
+
+static int write_header(uint64_t sites, uint64_t chunks)
+{
+    hal_log_file_header_t header;
+
+    memset(&header, 0, sizeof(header));
+    memcpy(header.magic, HAL_LOG_MAGIC, sizeof(HAL_LOG_MAGIC));
+    header.version = HAL_LOG_VERSION;
+    header.endian = HAL_LOG_ENDIAN;
+    header.sites = (uint32_t)sites;
+    header.chunk = LOG_CHUNK;
+    header.dataOffset = gDataOffset;
+    header.chunks = chunks;
+    header.dropped = __atomic_load_n(&gDropped, __ATOMIC_RELAXED);
+    return (pwrite(gFd, &header, sizeof(header), 0) == (ssize_t)sizeof(header)) ? 0 : -1;
+}
+
+/* Appends the call site table after the header and returns the page aligned offset of the first chunk */
+static int write_sites(const hal_log_site_t *first, uint64_t count)
+{
+    uint64_t offset = sizeof(hal_log_file_header_t);
+    long page = sysconf(_SC_PAGESIZE);
+    uint64_t i;
+
+    for (i = 0; i < count; i++)
+    {
+        uint32_t lengths[3] = { (uint32_t)first[i].line, (uint32_t)strlen(first[i].file), (uint32_t)strlen(first[i].format) };
+
+        if (pwrite(gFd, lengths, sizeof(lengths), (off_t)offset) != (ssize_t)sizeof(lengths) ||
+            pwrite(gFd, first[i].file, lengths[1], (off_t)(offset + sizeof(lengths))) != (ssize_t)lengths[1] ||
+            pwrite(gFd, first[i].format, lengths[2], (off_t)(offset + sizeof(lengths) + lengths[1])) != (ssize_t)lengths[2])
+        {
+            return -1;
+        }
+        offset += sizeof(lengths) + lengths[1] + lengths[2];
+    }
+    page = (page > 0) ? page : 4096;
+    gDataOffset = (offset + (uint64_t)page - 1) / (uint64_t)page * (uint64_t)page;
+    return 0;
+}
+
+static void stop_logging(void)
+{
+    uint64_t cursor;
+    uint64_t chunk;
+    uint64_t used;
+
+    __atomic_store_n(&gStopped, 1, __ATOMIC_RELEASE);
+    pthread_mutex_lock(&gChunkLock);
+    __atomic_store_n(&gFull, 1, __ATOMIC_RELEASE);
+    /* Pushing the cursor past the chunk makes any message still being placed take the lock and be dropped */
+    cursor = __atomic_fetch_add(&gCursor, (uint64_t)LOG_CHUNK + 1, __ATOMIC_ACQ_REL);
+    chunk = cursor >> CURSOR_BITS;
+    used = ((cursor & CURSOR_MASK) < LOG_CHUNK) ? (cursor & CURSOR_MASK) : LOG_CHUNK;
+    write_header((uint64_t)(__stop_hal_log_sites - __start_hal_log_sites), chunk + 1);
+    if (ftruncate(gFd, (off_t)(gDataOffset + chunk * LOG_CHUNK + used)) != 0)
+    {
+        printf("Failed to trim the binary log\n");
+    }
+    if (gDropped != 0)
+    {
+        printf("%llu log messages dropped, binary log full\n", (unsigned long long)gDropped);
+    }
+    pthread_mutex_unlock(&gChunkLock);
+}
+
+int hal_log_init(void)
+{
+    const char *path = getenv(HAL_LOG_FILE_ENV);
+    const char *size = getenv(HAL_LOG_SIZE_ENV);
+    uint64_t sites = (uint64_t)(__stop_hal_log_sites - __start_hal_log_sites);
+    uint64_t limit = (size != NULL) ? strtoull(size, NULL, 0) : LOG_SIZE_DEFAULT;
+    void *map;
+
+    path = (path != NULL) ? path : LOG_FILE_DEFAULT;
+    gMaxChunks = (limit + LOG_CHUNK - 1) / LOG_CHUNK;
+    gMaxChunks = (gMaxChunks > 0) ? gMaxChunks : 1;
+    gChunks = (uint8_t **)calloc((size_t)gMaxChunks, sizeof(*gChunks));
+    gFd = open(path, O_RDWR | O_CREAT | O_TRUNC, 0644);
+    if (gChunks == NULL || gFd < 0 || write_header(sites, 0) != 0 || write_sites(__start_hal_log_sites, sites) != 0 ||
+        ftruncate(gFd, (off_t)(gDataOffset + LOG_CHUNK)) != 0 ||
+        (map = mmap(NULL, LOG_CHUNK, PROT_READ | PROT_WRITE, MAP_SHARED, gFd, (off_t)gDataOffset)) == MAP_FAILED)
+    {
+        printf("Failed to create binary log %s\n", path);
+        if (gFd >= 0)
+        {
+            close(gFd);
+            gFd = -1;
+        }
+        return -1;
+    }
+    gChunks[0] = (uint8_t *)map;
+    UT_logPrefix(__FILE__, __LINE__, UT_LOG_PREFIX, "Binary log of %llu call sites in %s", (unsigned long long)sites, path);
+    atexit(stop_logging);
+    return 0;
+}
+
+#endif /* HAL_LOG_BINARY */
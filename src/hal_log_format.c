@@ -0,0 +1,452 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+* @file hal_log_format.c
+* @brief Deferred printf formatting, see hal_log_format.h.
+*
+* Formats are parsed twice, once when the arguments are captured to know which to copy and
+* once when they are rendered, where each conversion is rebuilt with '*' replaced by the
+* recorded value and a length modifier matching the slot, then formatted on its own.
+*/
+
+#include <stdio.h>
+#include <string.h>
+#include "hal_log_format.h"
+
+#define LOG_SPEC_MAX      (48)           /* length of one rebuilt conversion specification */
+#define LOG_NULL_STRING   UINT64_MAX
+
+#define ALIGN8(n)         (((size_t)(n) + 7) & ~(size_t)7)
+
+typedef enum
+{
+    ARG_NONE = 0,
+    ARG_INT,
+    ARG_UINT,
+    ARG_DOUBLE,
+    ARG_STRING,
+    ARG_POINTER,
+    ARG_COUNT
+} log_arg_kind_t;
+
+typedef enum
+{
+    LEN_NONE = 0,
+    LEN_HH,
+    LEN_H,
+    LEN_L,
+    LEN_LL,
+    LEN_J,
+    LEN_Z,
+    LEN_T,
+    LEN_LONG_DOUBLE
+} log_length_t;
+
+/* One conversion specification of a format */
+typedef struct
+{
+    const char *start;          /* the '%' */
+    const char *length;         /* first length modifier character, or the conversion */
+    const char *end;            /* one past the conversion */
+    int widthStar;
+    int precisionStar;
+    int precision;              /* -1 when absent or given by '*' */
+    log_length_t lengthKind;
+    log_arg_kind_t kind;
+    char conversion;
+} log_spec_t;
+
+
+/* p points after the '%'; returns the character after the specification */
+static const char *parse_spec(const char *p, log_spec_t *spec)
+{
+    memset(spec, 0, sizeof(*spec));
+    spec->start = p - 1;
+    spec->precision = -1;
+    while (*p != '\0' && strchr("-+ #0'", *p) != NULL)
+    {
+        p++;
+    }
+    if (*p == '*')
+    {
+        spec->widthStar = 1;
+        p++;
+    }
+    while (*p >= '0' && *p <= '9')
+    {
+        p++;
+    }
+    if (*p == '.')
+    {
+        p++;
+        if (*p == '*')
+        {
+            spec->precisionStar = 1;
+            p++;
+        }
+        else
+        {
+            spec->precision = 0;
+            while (*p >= '0' && *p <= '9')
+            {
+                spec->precision = spec->precision * 10 + (*p++ - '0');
+            }
+        }
+    }
+    spec->length = p;
+    switch (*p)
+    {
+        case 'h':
+            spec->lengthKind = (p[1] == 'h') ? LEN_HH : LEN_H;
+            p += (p[1] == 'h') ? 2 : 1;
+            break;
+        case 'l':
+            spec->lengthKind = (p[1] == 'l') ? LEN_LL : LEN_L;
+            p += (p[1] == 'l') ? 2 : 1;
+            break;
+        case 'j':
+            spec->lengthKind = LEN_J;
+            p++;
+            break;
+        case 'z':
+            spec->lengthKind = LEN_Z;
+            p++;
+            break;
+        case 't':
+            spec->lengthKind = LEN_T;
+            p++;
+            break;
+        case 'L':
+            spec->lengthKind = LEN_LONG_DOUBLE;
+            p++;
+            break;
+        default:
+            break;
+    }
+    spec->conversion = *p;
+    switch (*p)
+    {
+        case 'd': case 'i': case 'c':
+            spec->kind = ARG_INT;
+            break;
+        case 'u': case 'o': case 'x': case 'X':
+            spec->kind = ARG_UINT;
+            break;
+        case 'f': case 'F': case 'e': case 'E': case 'g': case 'G': case 'a': case 'A':
+            spec->kind = ARG_DOUBLE;
+            break;
+        case 's':
+            spec->kind = ARG_STRING;
+            break;
+        case 'p':
+            spec->kind = ARG_POINTER;
+            break;
+        case 'n':
+            spec->kind = ARG_COUNT;
+            break;
+        default:
+            break;
+    }
+    if (*p != '\0')
+    {
+        p++;
+    }
+    spec->end = p;
+    return p;
+}
+
+static int put_slot(uint8_t *payload, size_t *used, uint64_t value)
+{
+    if (*used + sizeof(value) > HAL_LOG_PAYLOAD_MAX)
+    {
+        return 0;
+    }
+    memcpy(payload + *used, &value, sizeof(value));
+    *used += sizeof(value);
+    return 1;
+}
+
+static int get_slot(const uint8_t *payload, size_t length, size_t *used, uint64_t *value)
+{
+    if (*used + sizeof(*value) > length)
+    {
+        return 0;
+    }
+    memcpy(value, payload + *used, sizeof(*value));
+    *used += sizeof(*value);
+    return 1;
+}
+
+static int64_t signed_arg(const log_spec_t *spec, va_list *ap)
+{
+    if (spec->conversion == 'c')
+    {
+        return va_arg(*ap, int);
+    }
+    switch (spec->lengthKind)
+    {
+        case LEN_HH: return (signed char)va_arg(*ap, int);
+        case LEN_H:  return (short)va_arg(*ap, int);
+        case LEN_L:  return va_arg(*ap, long);
+        case LEN_LL: return va_arg(*ap, long long);
+        case LEN_J:  return va_arg(*ap, intmax_t);
+        case LEN_Z:  return (int64_t)va_arg(*ap, size_t);
+        case LEN_T:  return va_arg(*ap, ptrdiff_t);
+        default:     return va_arg(*ap, int);
+    }
+}
+
+static uint64_t unsigned_arg(const log_spec_t *spec, va_list *ap)
+{
+    switch (spec->lengthKind)
+    {
+        case LEN_HH: return (unsigned char)va_arg(*ap, unsigned int);
+        case LEN_H:  return (unsigned short)va_arg(*ap, unsigned int);
+        case LEN_L:  return va_arg(*ap, unsigned long);
+        case LEN_LL: return va_arg(*ap, unsigned long long);
+        case LEN_J:  return va_arg(*ap, uintmax_t);
+        case LEN_Z:  return va_arg(*ap, size_t);
+        case LEN_T:  return (uint64_t)va_arg(*ap, ptrdiff_t);
+        default:     return va_arg(*ap, unsigned int);
+    }
+}
+
+size_t hal_log_capture(uint8_t *payload, const char *format, va_list *ap)
+{
+    const char *p = format;
+    size_t used = 0;
+    log_spec_t spec;
+
+    while ((p = strchr(p, '%')) != NULL)
+    {
+        uint64_t value = 0;
+        double number;
+
+        p = parse_spec(p + 1, &spec);
+        if (spec.widthStar && !put_slot(payload, &used, (uint64_t)(int64_t)va_arg(*ap, int)))
+        {
+            break;
+        }
+        if (spec.precisionStar)
+        {
+            int precision = va_arg(*ap, int);
+
+            spec.precision = (precision < 0) ? -1 : precision;
+            if (!put_slot(payload, &used, (uint64_t)(int64_t)precision))
+            {
+                break;
+            }
+        }
+        switch (spec.kind)
+        {
+            case ARG_INT:
+                value = (uint64_t)signed_arg(&spec, ap);
+                break;
+            case ARG_UINT:
+                value = unsigned_arg(&spec, ap);
+                break;
+            case ARG_DOUBLE:
+                number = (spec.lengthKind == LEN_LONG_DOUBLE) ? (double)va_arg(*ap, long double) : va_arg(*ap, double);
+                memcpy(&value, &number, sizeof(value));
+                break;
+            case ARG_POINTER:
+                value = (uint64_t)(uintptr_t)va_arg(*ap, void *);
+                break;
+            case ARG_COUNT:
+                (void)va_arg(*ap, void *);
+                continue;
+            case ARG_STRING:
+            {
+                const char *string = va_arg(*ap, const char *);
+                size_t length;
+
+                if (string == NULL)
+                {
+                    value = LOG_NULL_STRING;
+                    break;
+                }
+                length = (spec.precision >= 0) ? strnlen(string, (size_t)spec.precision) : strlen(string);
+                if (used + sizeof(value) + length > HAL_LOG_PAYLOAD_MAX)
+                {
+                    length = (used + sizeof(value) < HAL_LOG_PAYLOAD_MAX) ? HAL_LOG_PAYLOAD_MAX - used - sizeof(value) : 0;
+                }
+                if (!put_slot(payload, &used, length))
+                {
+                    return used;
+                }
+                memcpy(payload + used, string, length);
+                used = ALIGN8(used + length);
+                continue;
+            }
+            default:
+                continue;
+        }
+        if (!put_slot(payload, &used, value))
+        {
+            break;
+        }
+    }
+    return used;
+}
+
+static void append(char *out, size_t size, size_t *pos, const char *text, size_t length)
+{
+    if (*pos + length >= size)
+    {
+        length = size - *pos - 1;
+    }
+    memcpy(out + *pos, text, length);
+    *pos += length;
+    out[*pos] = '\0';
+}
+
+/* Rebuilds one specification with '*' replaced by the recorded values and the length modifier matching the slot */
+static int build_spec(char *text, const log_spec_t *spec, const uint8_t *payload, size_t length, size_t *used)
+{
+    const char *p;
+    size_t t = 0;
+
+    for (p = spec->start; p < spec->length; p++)
+    {
+        if (t + 24 >= LOG_SPEC_MAX)
+        {
+            return 0;
+        }
+        if (*p == '*')
+        {
+            uint64_t value;
+
+            if (!get_slot(payload, length, used, &value))
+            {
+                return 0;
+            }
+            if ((int64_t)value < 0 && p[-1] == '.')
+            {
+                t--;    /* A negative precision is taken as if it were omitted */
+                continue;
+            }
+            t += (size_t)snprintf(text + t, LOG_SPEC_MAX - t, "%lld", (long long)(int64_t)value);
+            continue;
+        }
+        text[t++] = *p;
+    }
+    if (spec->kind == ARG_INT && spec->conversion != 'c')
+    {
+        text[t++] = 'l';
+        text[t++] = 'l';
+    }
+    else if (spec->kind == ARG_UINT)
+    {
+        text[t++] = 'l';
+        text[t++] = 'l';
+    }
+    text[t++] = spec->conversion;
+    text[t] = '\0';
+    return 1;
+}
+
+void hal_log_render(char *out, size_t size, const char *format, const uint8_t *payload, size_t length)
+{
+    const char *p = format;
+    size_t pos = 0;
+    size_t used = 0;
+    log_spec_t spec;
+
+    out[0] = '\0';
+    while (*p != '\0' && pos + 1 < size)
+    {
+        const char *percent = strchr(p, '%');
+        char text[LOG_SPEC_MAX];
+        uint64_t value;
+        double number;
+        int written = 0;
+
+        if (percent == NULL)
+        {
+            append(out, size, &pos, p, strlen(p));
+            break;
+        }
+        append(out, size, &pos, p, (size_t)(percent - p));
+        p = parse_spec(percent + 1, &spec);
+        if (spec.kind == ARG_NONE)
+        {
+            if (spec.conversion == '%')
+            {
+                append(out, size, &pos, "%", 1);
+            }
+            else if (spec.conversion != '\0')
+            {
+                append(out, size, &pos, spec.start, (size_t)(spec.end - spec.start));
+            }
+            continue;
+        }
+        if (spec.kind == ARG_COUNT)
+        {
+            continue;
+        }
+        if (!build_spec(text, &spec, payload, length, &used) || !get_slot(payload, length, &used, &value))
+        {
+            append(out, size, &pos, "...", 3);
+            break;
+        }
+        switch (spec.kind)
+        {
+            case ARG_INT:
+                written = (spec.conversion == 'c') ? snprintf(out + pos, size - pos, text, (int)value)
+                                                   : snprintf(out + pos, size - pos, text, (long long)(int64_t)value);
+                break;
+            case ARG_UINT:
+                written = snprintf(out + pos, size - pos, text, (unsigned long long)value);
+                break;
+            case ARG_DOUBLE:
+                memcpy(&number, &value, sizeof(number));
+                written = snprintf(out + pos, size - pos, text, number);
+                break;
+            case ARG_POINTER:
+                written = snprintf(out + pos, size - pos, text, (void *)(uintptr_t)value);
+                break;
+            case ARG_STRING:
+                if (value == LOG_NULL_STRING)
+                {
+                    written = snprintf(out + pos, size - pos, text, (const char *)NULL);
+                }
+                else if (value > length - used || value > HAL_LOG_PAYLOAD_MAX)
+                {
+                    append(out, size, &pos, "...", 3);
+                    return;
+                }
+                else
+                {
+                    char string[HAL_LOG_PAYLOAD_MAX + 1];
+
+                    memcpy(string, payload + used, (size_t)value);
+                    string[value] = '\0';
+                    used = ALIGN8(used + (size_t)value);
+                    written = snprintf(out + pos, size - pos, text, string);
+                }
+                break;
+            default:
+                break;
+        }
+        if (written > 0)
+        {
+            pos = ((size_t)written < size - pos) ? pos + (size_t)written : size - 1;
+        }
+    }
+}
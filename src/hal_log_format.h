@@ -0,0 +1,99 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+* @file hal_log_format.h
+* @brief Deferred printf formatting, shared by the log backends and the binary log decoder.
+*
+* hal_log_capture() parses a format and copies the arguments it consumes into a payload. Each
+* argument takes one 8 byte slot, including '*' widths and precisions, except strings, which
+* take a length slot (UINT64_MAX for NULL) followed by their bytes padded to 8. Integers are
+* stored after the conversion's own truncation and long doubles as doubles. hal_log_render()
+* later formats the payload against the same format one conversion at a time, giving the text
+* printf would have. The format itself is never copied and must outlive the payload.
+*
+* Binary log file written by LOG=binary builds, all integers in the writer's byte order:
+*
+*     file    := header site* padding chunk*
+*     header  := hal_log_file_header_t
+*     site    := line(u32) file_length(u32) format_length(u32) file format
+*     chunk   := record* zero*                      each chunk but the last is chunk bytes long
+*     record  := hal_log_record_t payload padding   size covers all three, multiple of 8
+*
+* The chunks start at dataOffset, which is page aligned. A record size of 0 ends the records
+* of a chunk. chunks is 0 when the writer did not exit cleanly; the file size then bounds the
+* data and a record with an unknown site is a torn write.
+*/
+
+#ifndef __HAL_LOG_FORMAT_H__
+#define __HAL_LOG_FORMAT_H__
+
+#include <stdarg.h>
+#include <stddef.h>
+#include <stdint.h>
+
+#define HAL_LOG_PAYLOAD_MAX  (8 * 1024)     /* arguments of one message, longer strings are truncated */
+
+#define HAL_LOG_MAGIC        "HALBLOG"
+#define HAL_LOG_VERSION      (1)
+#define HAL_LOG_ENDIAN       (0x01020304)
+
+typedef struct
+{
+    char magic[8];          /**< HAL_LOG_MAGIC */
+    uint32_t version;       /**< HAL_LOG_VERSION */
+    uint32_t endian;        /**< HAL_LOG_ENDIAN as written */
+    uint32_t sites;         /**< Entries in the call site table */
+    uint32_t chunk;         /**< Bytes per chunk */
+    uint64_t dataOffset;    /**< File offset of the first chunk */
+    uint64_t chunks;        /**< Chunks written, 0 if the writer did not exit cleanly */
+    uint64_t dropped;       /**< Messages discarded because the file reached its size limit */
+} hal_log_file_header_t;
+
+typedef struct
+{
+    uint32_t size;          /**< Bytes of the record, including this header */
+    uint32_t id;            /**< Index of the call site */
+    uint64_t timeNs;        /**< CLOCK_REALTIME in nanoseconds */
+} hal_log_record_t;
+
+/**
+* @brief Copy the arguments a format consumes.
+*
+* A message too large for the payload keeps its leading arguments and is rendered with "..." after them.
+*
+* @param[out]    payload - Buffer of HAL_LOG_PAYLOAD_MAX bytes
+* @param[in]     format  - printf format
+* @param[in,out] ap      - Arguments, advanced past those consumed
+*
+* @return Bytes of payload used
+*/
+size_t hal_log_capture(uint8_t *payload, const char *format, va_list *ap);
+
+/**
+* @brief Format a payload captured from the same format.
+*
+* @param[out] out     - Text, always terminated
+* @param[in]  size    - Size of out
+* @param[in]  format  - printf format the payload was captured with
+* @param[in]  payload - Payload
+* @param[in]  length  - Bytes of payload, which is checked against it
+*/
+void hal_log_render(char *out, size_t size, const char *format, const uint8_t *payload, size_t length);
+
+#endif /* __HAL_LOG_FORMAT_H__ */
@@ -0,0 +1,90 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+* @file hal_mac.c
+* @brief Table driven MAC address string validation, see hal_mac.h.
+*/
+
+#include "hal_mac.h"
+
+#define CLASS_HEX   (0x01)
+#define CLASS_COLON (0x02)
+#define CLASS_END   (0x04)
+
+/* Character class of every byte value */
+static const uint8_t gClass[256] =
+{
+    [0]   = CLASS_END,
+    [':'] = CLASS_COLON,
+    ['0'] = CLASS_HEX, ['1'] = CLASS_HEX, ['2'] = CLASS_HEX, ['3'] = CLASS_HEX, ['4'] = CLASS_HEX,
+    ['5'] = CLASS_HEX, ['6'] = CLASS_HEX, ['7'] = CLASS_HEX, ['8'] = CLASS_HEX, ['9'] = CLASS_HEX,
+    ['A'] = CLASS_HEX, ['B'] = CLASS_HEX, ['C'] = CLASS_HEX, ['D'] = CLASS_HEX, ['E'] = CLASS_HEX, ['F'] = CLASS_HEX,
+    ['a'] = CLASS_HEX, ['b'] = CLASS_HEX, ['c'] = CLASS_HEX, ['d'] = CLASS_HEX, ['e'] = CLASS_HEX, ['f'] = CLASS_HEX,
+};
+
+/* Class required at each position of "xx:xx:xx:xx:xx:xx\0" */
+static const uint8_t gPattern[HAL_MAC_STRING_LENGTH + 1] =
+{
+    CLASS_HEX, CLASS_HEX, CLASS_COLON,
+    CLASS_HEX, CLASS_HEX, CLASS_COLON,
+    CLASS_HEX, CLASS_HEX, CLASS_COLON,
+    CLASS_HEX, CLASS_HEX, CLASS_COLON,
+    CLASS_HEX, CLASS_HEX, CLASS_COLON,
+    CLASS_HEX, CLASS_HEX, CLASS_END,
+};
+
+static int check(const unsigned char *mac)
+{
+    unsigned int ok = 1;
+    int i;
+
+    for (i = 0; i <= HAL_MAC_STRING_LENGTH; i++)
+    {
+        ok &= (unsigned int)(gClass[mac[i]] == gPattern[i]);
+    }
+    return (int)ok;
+}
+
+int hal_mac_valid(const char *mac)
+{
+    if (mac == NULL)
+    {
+        return 0;
+    }
+    return check((const unsigned char *)mac);
+}
+
+size_t hal_mac_validate(const void *base, size_t stride, size_t count, uint8_t *valid)
+{
+    const unsigned char *mac = (const unsigned char *)base;
+    size_t total = 0;
+    size_t i;
+
+    for (i = 0; base != NULL && i < count; i++, mac += stride)
+    {
+        int ok = check(mac);
+
+        if (valid != NULL)
+        {
+            valid[i] = (uint8_t)ok;
+        }
+        total += (size_t)ok;
+    }
+    return total;
+}
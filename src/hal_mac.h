@@ -0,0 +1,58 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+* @file hal_mac.h
+* @brief MAC address string validation shared by the tests.
+*
+* A valid MAC string is exactly six pairs of hexadecimal digits, either case, separated by
+* colons ("02:00:5e:10:AB:ff") and terminated after 17 characters. Each check is a fixed
+* sequence of 18 table lookups with no data dependent branches, so validating a fully
+* populated DSCP client list (64 x 255 entries) costs well under a millisecond.
+*/
+
+#ifndef __HAL_MAC_H__
+#define __HAL_MAC_H__
+
+#include <stddef.h>
+#include <stdint.h>
+
+#define HAL_MAC_STRING_LENGTH (17)
+
+/**
+* @brief Check one MAC string.
+*
+* @param[in] mac - Buffer of at least HAL_MAC_STRING_LENGTH + 1 bytes, all of which are read
+*
+* @return 1 if the buffer holds a valid MAC string, 0 otherwise (including NULL)
+*/
+int hal_mac_valid(const char *mac);
+
+/**
+* @brief Check an array of MAC strings stored at a fixed stride, e.g. the mac member of an array of structures.
+*
+* @param[in]  base   - First MAC string
+* @param[in]  stride - Distance in bytes between consecutive MAC strings
+* @param[in]  count  - Number of MAC strings
+* @param[out] valid  - Optional array of count results, 1 for a valid entry and 0 otherwise
+*
+* @return Number of valid entries
+*/
+size_t hal_mac_validate(const void *base, size_t stride, size_t count, uint8_t *valid);
+
+#endif /* __HAL_MAC_H__ */
@@ -0,0 +1,756 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+* @file hal_race.c
+* @brief Concurrent set and get stress, deadlock watchdog and latency report, see hal_race.h.
+*/
+
+#include <ut.h>
+#include <ut_log.h>
+#include <pthread.h>
+#include <signal.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include "platform_hal.h"
+#include "hal_case.h"
+#include "hal_race.h"
+#include "hal_soak.h"
+
+#define NS_PER_S    (1000000000ull)
+#define NS_PER_MS   (1000000ull)
+#define BUCKETS     (48)          /* Power of two buckets of nanoseconds */
+#define ALONE_NS    (NS_PER_S)    /* Longest single thread run of a pair */
+#define WATCHDOG_MS (100)
+
+#define COUNT(array) (sizeof(array) / sizeof((array)[0]))
+
+enum
+{
+    RACE_OK = 0,
+    RACE_FAILED,
+    RACE_IMPOSSIBLE
+};
+
+enum
+{
+    ROLE_READER = 0,
+    ROLE_WRITER,
+    ROLE_ALONE
+};
+
+enum
+{
+    SLOT_GET = 0,
+    SLOT_SET,
+    SLOTS
+};
+
+typedef struct
+{
+    unsigned long calls;
+    uint64_t      ns;
+    uint64_t      maxNs;
+    unsigned long bucket[BUCKETS];
+} race_latency_t;
+
+typedef struct
+{
+    const char   *name;
+    hal_api_id_t  get;
+    hal_api_id_t  set;
+    int         (*save)(void);
+    int         (*write)(unsigned long n);
+    int         (*read)(void);
+    void        (*restore)(void);
+} race_pair_t;
+
+typedef struct
+{
+    pthread_t          thread;
+    const race_pair_t *pair;
+    int                role;
+    int                finished;
+    unsigned long      n;          /* Index of the next value written */
+    uint64_t           callStart;  /* Start of the current HAL call, 0 outside one */
+    hal_api_id_t       api;
+    unsigned long      reads;
+    unsigned long      writes;
+    unsigned long      impossible;
+    unsigned long      failed;
+    race_latency_t     latency[SLOTS];
+} race_worker_t;
+
+static const int gCrashSignals[] = { SIGSEGV, SIGBUS, SIGFPE, SIGILL, SIGABRT };
+
+static int gEnabled = 0;
+static uint64_t gDurationS = 0;
+static long gThreads = HAL_RACE_DEFAULT_THREADS;
+static long gTimeoutS = HAL_RACE_DEFAULT_TIMEOUT_S;
+static int gStop = 0;
+static struct sigaction gPrevious[COUNT(gCrashSignals)];
+static __thread race_worker_t *tWorker = NULL;
+
+extern int *FanIndex;
+extern int num_FanIndex;
+
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * NS_PER_S + (uint64_t)ts.tv_nsec;
+}
+
+static void record(race_latency_t *latency, uint64_t ns)
+{
+    int bucket = (ns == 0) ? 0 : 63 - __builtin_clzll(ns);
+
+    if (bucket >= BUCKETS)
+    {
+        bucket = BUCKETS - 1;
+    }
+    latency->calls++;
+    latency->ns += ns;
+    if (ns > latency->maxNs)
+    {
+        latency->maxNs = ns;
+    }
+    latency->bucket[bucket]++;
+}
+
+/* Time a HAL call of the current thread, publishing it to the watchdog while it runs */
+#define TIMED(slot, id, call) \
+    do \
+    { \
+        uint64_t start_ = now_ns(); \
+        __atomic_store_n(&tWorker->api, (id), __ATOMIC_RELAXED); \
+        __atomic_store_n(&tWorker->callStart, start_, __ATOMIC_RELEASE); \
+        call; \
+        __atomic_store_n(&tWorker->callStart, 0, __ATOMIC_RELEASE); \
+        record(&tWorker->latency[(slot)], now_ns() - start_); \
+    } while (0)
+
+/* A setting holding a scalar: writers cycle through the values, readers must see one of them */
+#define RACE_SCALAR(name, type, ...) \
+    static const type g##name##Values[] = { __VA_ARGS__ }; \
+    static type g##name##Saved; \
+    static int save_##name(void) \
+    { \
+        return (platform_hal_Get##name(&g##name##Saved) == RETURN_OK) ? 0 : -1; \
+    } \
+    static void restore_##name(void) \
+    { \
+        platform_hal_Set##name(g##name##Saved); \
+    } \
+    static int write_##name(unsigned long n) \
+    { \
+        INT result; \
+        TIMED(SLOT_SET, HAL_API_ID_Set##name, \
+              result = platform_hal_Set##name(g##name##Values[n % COUNT(g##name##Values)])); \
+        return (result == RETURN_OK) ? RACE_OK : RACE_FAILED; \
+    } \
+    static int read_##name(void) \
+    { \
+        type value; \
+        size_t i; \
+        INT result; \
+        memset(&value, 0, sizeof(value)); \
+        TIMED(SLOT_GET, HAL_API_ID_Get##name, result = platform_hal_Get##name(&value)); \
+        if (result != RETURN_OK) \
+        { \
+            return RACE_FAILED; \
+        } \
+        for (i = 0; i < COUNT(g##name##Values); i++) \
+        { \
+            if (value == g##name##Values[i]) \
+            { \
+                return RACE_OK; \
+            } \
+        } \
+        return RACE_IMPOSSIBLE; \
+    }
+
+RACE_SCALAR(SSHEnable, BOOLEAN, FALSE, TRUE)
+RACE_SCALAR(TelnetEnable, BOOLEAN, FALSE, TRUE)
+/* Byte mixes of these values, e.g. 0x00015110, are not in the set */
+RACE_SCALAR(WebUITimeout, ULONG, 30, 3600, 86400)
+
+/* Values of different lengths, so a read with the tail of a longer one is caught */
+static const char *const gSNMPEnableValues[] = { "rgWan", "rgDualIp", "rgLanIp" };
+static CHAR gSNMPEnableSaved[32];
+
+static int save_SNMPEnable(void)
+{
+    memset(gSNMPEnableSaved, 0, sizeof(gSNMPEnableSaved));
+    if (platform_hal_GetSNMPEnable(gSNMPEnableSaved) != RETURN_OK)
+    {
+        return -1;
+    }
+    gSNMPEnableSaved[sizeof(gSNMPEnableSaved) - 1] = '\0';
+    return 0;
+}
+
+static void restore_SNMPEnable(void)
+{
+    platform_hal_SetSNMPEnable(gSNMPEnableSaved);
+}
+
+static int write_SNMPEnable(unsigned long n)
+{
+    CHAR value[32];
+    INT result;
+
+    strncpy(value, gSNMPEnableValues[n % COUNT(gSNMPEnableValues)], sizeof(value) - 1);
+    value[sizeof(value) - 1] = '\0';
+    TIMED(SLOT_SET, HAL_API_ID_SetSNMPEnable, result = platform_hal_SetSNMPEnable(value));
+    return (result == RETURN_OK) ? RACE_OK : RACE_FAILED;
+}
+
+static int read_SNMPEnable(void)
+{
+    CHAR value[32];
+    size_t i;
+    INT result;
+
+    memset(value, 0, sizeof(value));
+    TIMED(SLOT_GET, HAL_API_ID_GetSNMPEnable, result = platform_hal_GetSNMPEnable(value));
+    if (result != RETURN_OK)
+    {
+        return RACE_FAILED;
+    }
+    value[sizeof(value) - 1] = '\0';
+    for (i = 0; i < COUNT(gSNMPEnableValues); i++)
+    {
+        if (strcmp(value, gSNMPEnableValues[i]) == 0)
+        {
+            return RACE_OK;
+        }
+    }
+    return RACE_IMPOSSIBLE;
+}
+
+/* Colours and intervals differ between the values, so a read taking them from two setLed calls matches none */
+static const LEDMGMT_PARAMS gLedValues[] =
+{
+    { .LedColor = LED_WHITE, .State = 0, .Interval = 0 },
+    { .LedColor = LED_RED, .State = 1, .Interval = 1 },
+    { .LedColor = LED_GREEN, .State = 1, .Interval = 5 },
+};
+static LEDMGMT_PARAMS gLedSaved;
+
+static int save_Led(void)
+{
+    memset(&gLedSaved, 0, sizeof(gLedSaved));
+    return (platform_hal_getLed(&gLedSaved) == RETURN_OK) ? 0 : -1;
+}
+
+static void restore_Led(void)
+{
+    platform_hal_setLed(&gLedSaved);
+}
+
+static int write_Led(unsigned long n)
+{
+    LEDMGMT_PARAMS value = gLedValues[n % COUNT(gLedValues)];
+    INT result;
+
+    TIMED(SLOT_SET, HAL_API_ID_setLed, result = platform_hal_setLed(&value));
+    return (result == RETURN_OK) ? RACE_OK : RACE_FAILED;
+}
+
+static int read_Led(void)
+{
+    LEDMGMT_PARAMS value;
+    size_t i;
+    INT result;
+
+    memset(&value, 0, sizeof(value));
+    TIMED(SLOT_GET, HAL_API_ID_getLed, result = platform_hal_getLed(&value));
+    if (result != RETURN_OK)
+    {
+        return RACE_FAILED;
+    }
+    for (i = 0; i < COUNT(gLedValues); i++)
+    {
+        if (value.LedColor == gLedValues[i].LedColor && value.State == gLedValues[i].State &&
+            value.Interval == gLedValues[i].Interval)
+        {
+            return RACE_OK;
+        }
+    }
+    return RACE_IMPOSSIBLE;
+}
+
+#ifdef FEATURE_RDKB_THERMAL_MANAGER
+/* The fan is left to the thermal manager afterwards, its speed in RPM cannot be set back */
+static const FAN_SPEED gFanSpeedValues[] = { FAN_SPEED_SLOW, FAN_SPEED_MEDIUM, FAN_SPEED_FAST };
+
+static int save_FanSpeed(void)
+{
+    return (FanIndex != NULL && num_FanIndex > 0) ? 0 : -1;
+}
+
+static int write_FanSpeed(unsigned long n)
+{
+    FAN_ERR reason = FAN_ERR_NONE;
+    INT result;
+
+    TIMED(SLOT_SET, HAL_API_ID_setFanSpeed,
+          result = platform_hal_setFanSpeed(FanIndex[0], gFanSpeedValues[n % COUNT(gFanSpeedValues)], &reason));
+    if (result != RETURN_OK)
+    {
+        return RACE_FAILED;
+    }
+    return (reason == FAN_ERR_NONE) ? RACE_OK : RACE_IMPOSSIBLE;
+}
+
+static int read_FanSpeed(void)
+{
+    UINT speed;
+
+    TIMED(SLOT_GET, HAL_API_ID_getFanSpeed, speed = platform_hal_getFanSpeed(FanIndex[0]));
+    (void)speed;
+    return RACE_OK;
+}
+#endif
+
+static const race_pair_t gPairs[] =
+{
+    { "SSHEnable", HAL_API_ID_GetSSHEnable, HAL_API_ID_SetSSHEnable, save_SSHEnable, write_SSHEnable, read_SSHEnable, restore_SSHEnable },
+    { "TelnetEnable", HAL_API_ID_GetTelnetEnable, HAL_API_ID_SetTelnetEnable, save_TelnetEnable, write_TelnetEnable, read_TelnetEnable, restore_TelnetEnable },
+    { "SNMPEnable", HAL_API_ID_GetSNMPEnable, HAL_API_ID_SetSNMPEnable, save_SNMPEnable, write_SNMPEnable, read_SNMPEnable, restore_SNMPEnable },
+    { "WebUITimeout", HAL_API_ID_GetWebUITimeout, HAL_API_ID_SetWebUITimeout, save_WebUITimeout, write_WebUITimeout, read_WebUITimeout, restore_WebUITimeout },
+    { "Led", HAL_API_ID_getLed, HAL_API_ID_setLed, save_Led, write_Led, read_Led, restore_Led },
+#ifdef FEATURE_RDKB_THERMAL_MANAGER
+    { "FanSpeed", HAL_API_ID_getFanSpeed, HAL_API_ID_setFanSpeed, save_FanSpeed, write_FanSpeed, read_FanSpeed, NULL },
+#endif
+};
+
+static void put(const char *text)
+{
+    ssize_t written = write(STDERR_FILENO, text, strlen(text));
+
+    (void)written;
+}
+
+/* Name the API a crashing thread was in, then let the signal take its normal course */
+static void crashed(int signal, siginfo_t *info, void *context)
+{
+    race_worker_t *worker = tWorker;
+    const char *name = NULL;
+    size_t i;
+
+    (void)context;
+    if (worker != NULL && __atomic_load_n(&worker->callStart, __ATOMIC_ACQUIRE) != 0)
+    {
+        name = hal_case_api_name(worker->api);
+    }
+    put("hal_race: fatal signal ");
+    put(signal == SIGSEGV ? "SIGSEGV" : signal == SIGBUS ? "SIGBUS" : signal == SIGFPE ? "SIGFPE" :
+        signal == SIGILL ? "SIGILL" : "SIGABRT");
+    if (name != NULL)
+    {
+        put(" in platform_hal_");
+        put(name);
+        put(worker->role == ROLE_WRITER ? " on a writer thread\n" :
+            worker->role == ROLE_READER ? " on a reader thread\n" : " called from one thread\n");
+    }
+    else
+    {
+        put(" outside a HAL call\n");
+    }
+    for (i = 0; i < COUNT(gCrashSignals); i++)
+    {
+        if (gCrashSignals[i] == signal)
+        {
+            sigaction(signal, &gPrevious[i], NULL);
+        }
+    }
+    /* A fault repeats when the handler returns, a sent signal has to be raised again */
+    if (info == NULL || info->si_code <= 0)
+    {
+        raise(signal);
+    }
+}
+
+static void catch_crashes(int enable)
+{
+    struct sigaction action;
+    size_t i;
+
+    memset(&action, 0, sizeof(action));
+    action.sa_sigaction = crashed;
+    action.sa_flags = SA_SIGINFO;
+    sigemptyset(&action.sa_mask);
+    for (i = 0; i < COUNT(gCrashSignals); i++)
+    {
+        if (enable)
+        {
+            sigaction(gCrashSignals[i], &action, &gPrevious[i]);
+        }
+        else
+        {
+            sigaction(gCrashSignals[i], &gPrevious[i], NULL);
+        }
+    }
+}
+
+static void tally(race_worker_t *worker, int outcome)
+{
+    if (outcome == RACE_FAILED)
+    {
+        worker->failed++;
+    }
+    else if (outcome == RACE_IMPOSSIBLE)
+    {
+        worker->impossible++;
+    }
+}
+
+static void *worker_thread(void *arg)
+{
+    race_worker_t *self = arg;
+
+    tWorker = self;
+    while (!__atomic_load_n(&gStop, __ATOMIC_ACQUIRE))
+    {
+        if (self->role == ROLE_WRITER)
+        {
+            tally(self, self->pair->write(self->n++));
+            self->writes++;
+        }
+        else
+        {
+            tally(self, self->pair->read());
+            self->reads++;
+        }
+    }
+    __atomic_store_n(&self->finished, 1, __ATOMIC_RELEASE);
+    return NULL;
+}
+
+/* Write then read from this thread only; -1 when the very first write fails */
+static int run_alone(const race_pair_t *pair, race_worker_t *alone, uint64_t ns)
+{
+    uint64_t end = now_ns() + ns;
+    int outcome;
+
+    tWorker = alone;
+    do
+    {
+        outcome = pair->write(alone->n++);
+        alone->writes++;
+        if (outcome == RACE_FAILED && alone->writes == 1)
+        {
+            tWorker = NULL;
+            return -1;
+        }
+        tally(alone, outcome);
+        tally(alone, pair->read());
+        alone->reads++;
+    } while (now_ns() < end);
+    tWorker = NULL;
+    return 0;
+}
+
+static void report_deadlock(const race_pair_t *pair, race_worker_t *workers, long count, uint64_t now)
+{
+    uint64_t start;
+    long i;
+
+    printf("[%s] deadlock: a thread has been inside the HAL for more than %ld s\n", pair->name, gTimeoutS);
+    for (i = 0; i < count; i++)
+    {
+        start = __atomic_load_n(&workers[i].callStart, __ATOMIC_ACQUIRE);
+        if (start != 0)
+        {
+            printf("  %s thread %ld in platform_hal_%s for %.1f s\n", (workers[i].role == ROLE_WRITER) ? "writer" : "reader",
+                   i, hal_case_api_name(__atomic_load_n(&workers[i].api, __ATOMIC_RELAXED)), (now - start) / 1e9);
+        }
+    }
+    printf("  threads not listed are outside the HAL\n");
+}
+
+/* Stop the workers at the end and wait for them, -1 when one stays stuck in a call */
+static int watch(const race_pair_t *pair, race_worker_t *workers, long count, uint64_t end)
+{
+    struct timespec pause = { 0, WATCHDOG_MS * NS_PER_MS };
+    uint64_t start;
+    uint64_t now;
+    long running;
+    long i;
+
+    for (;;)
+    {
+        nanosleep(&pause, NULL);
+        now = now_ns();
+        if (now >= end)
+        {
+            __atomic_store_n(&gStop, 1, __ATOMIC_RELEASE);
+        }
+        running = 0;
+        for (i = 0; i < count; i++)
+        {
+            if (__atomic_load_n(&workers[i].finished, __ATOMIC_ACQUIRE))
+            {
+                continue;
+            }
+            running++;
+            start = __atomic_load_n(&workers[i].callStart, __ATOMIC_ACQUIRE);
+            if (start != 0 && now > start && now - start > (uint64_t)gTimeoutS * NS_PER_S)
+            {
+                __atomic_store_n(&gStop, 1, __ATOMIC_RELEASE);
+                report_deadlock(pair, workers, count, now);
+                return -1;
+            }
+        }
+        if (running == 0)
+        {
+            return 0;
+        }
+    }
+}
+
+static void merge(race_latency_t *into, const race_latency_t *from)
+{
+    int b;
+
+    into->calls += from->calls;
+    into->ns += from->ns;
+    if (from->maxNs > into->maxNs)
+    {
+        into->maxNs = from->maxNs;
+    }
+    for (b = 0; b < BUCKETS; b++)
+    {
+        into->bucket[b] += from->bucket[b];
+    }
+}
+
+static double mean_us(const race_latency_t *latency)
+{
+    return (latency->calls != 0) ? latency->ns / 1000.0 / latency->calls : 0;
+}
+
+/* Upper edge of the bucket holding the 99th percentile */
+static double p99_us(const race_latency_t *latency)
+{
+    unsigned long target = latency->calls - latency->calls / 100;
+    unsigned long seen = 0;
+    int b;
+
+    for (b = 0; b < BUCKETS; b++)
+    {
+        seen += latency->bucket[b];
+        if (seen >= target && seen != 0)
+        {
+            return (double)(1ull << (b + 1)) / 1000.0;
+        }
+    }
+    return 0;
+}
+
+static void report_latency(hal_api_id_t api, const race_latency_t *alone, const race_latency_t *contended)
+{
+    double before = mean_us(alone);
+    double after = mean_us(contended);
+
+    printf("  %-22s %10.1f %10.1f %10.1f   %10.1f %10.1f %10.1f   %8.1fx\n", hal_case_api_name(api),
+           before, p99_us(alone), alone->maxNs / 1000.0, after, p99_us(contended), contended->maxNs / 1000.0,
+           (before > 0) ? after / before : 0);
+}
+
+int hal_race_run(void)
+{
+    race_worker_t *workers;
+    race_worker_t alone;
+    race_worker_t total;
+    uint64_t budgetNs = gDurationS * NS_PER_S / COUNT(gPairs);
+    uint64_t aloneNs = (budgetNs / 4 < ALONE_NS) ? budgetNs / 4 : ALONE_NS;
+    unsigned long long impossible = 0;
+    unsigned long long failed = 0;
+    size_t p;
+    long created;
+    long i;
+    int s;
+
+    printf("Race run of %llu s over %zu pairs with %ld threads each\n", (unsigned long long)gDurationS,
+           COUNT(gPairs), gThreads);
+    catch_crashes(1);
+    for (p = 0; p < COUNT(gPairs); p++)
+    {
+        const race_pair_t *pair = &gPairs[p];
+
+        if (pair->save() != 0)
+        {
+            printf("[%s] skipped, platform_hal_%s fails\n", pair->name, hal_case_api_name(pair->get));
+            continue;
+        }
+        memset(&alone, 0, sizeof(alone));
+        alone.pair = pair;
+        alone.role = ROLE_ALONE;
+        if (run_alone(pair, &alone, aloneNs) != 0)
+        {
+            printf("[%s] skipped, platform_hal_%s fails\n", pair->name, hal_case_api_name(pair->set));
+            continue;
+        }
+
+        workers = calloc((size_t)gThreads, sizeof(*workers));
+        if (workers == NULL)
+        {
+            printf("hal_race: out of memory\n");
+            catch_crashes(0);
+            return -1;
+        }
+        __atomic_store_n(&gStop, 0, __ATOMIC_RELEASE);
+        for (created = 0; created < gThreads; created++)
+        {
+            workers[created].pair = pair;
+            workers[created].role = (created % 2 == 0) ? ROLE_WRITER : ROLE_READER;
+            workers[created].n = (unsigned long)created / 2;
+            if (pthread_create(&workers[created].thread, NULL, worker_thread, &workers[created]) != 0)
+            {
+                break;
+            }
+        }
+        if (created < gThreads)
+        {
+            printf("hal_race: cannot start thread %ld\n", created);
+            __atomic_store_n(&gStop, 1, __ATOMIC_RELEASE);
+            for (i = 0; i < created; i++)
+            {
+                pthread_join(workers[i].thread, NULL);
+            }
+            free(workers);
+            catch_crashes(0);
+            return -1;
+        }
+        if (watch(pair, workers, gThreads, now_ns() + budgetNs - aloneNs) != 0)
+        {
+            /* Stuck threads still use the workers, they end with the process */
+            catch_crashes(0);
+            return -1;
+        }
+
+        memset(&total, 0, sizeof(total));
+        for (i = 0; i < gThreads; i++)
+        {
+            pthread_join(workers[i].thread, NULL);
+            total.reads += workers[i].reads;
+            total.writes += workers[i].writes;
+            total.impossible += workers[i].impossible;
+            total.failed += workers[i].failed;
+            for (s = 0; s < SLOTS; s++)
+            {
+                merge(&total.latency[s], &workers[i].latency[s]);
+            }
+        }
+        free(workers);
+        if (pair->restore != NULL)
+        {
+            pair->restore();
+        }
+
+        printf("[%s] %ld threads for %.1f s: %lu writes, %lu reads, %lu impossible reads, %lu failed calls\n",
+               pair->name, gThreads, (budgetNs - aloneNs) / 1e9, total.writes, total.reads,
+               total.impossible + alone.impossible, total.failed + alone.failed);
+        printf("  %-22s %10s %10s %10s   %10s %10s %10s   %9s\n", "latency us", "alone", "p99", "max",
+               "contended", "p99", "max", "slowdown");
+        report_latency(pair->set, &alone.latency[SLOT_SET], &total.latency[SLOT_SET]);
+        report_latency(pair->get, &alone.latency[SLOT_GET], &total.latency[SLOT_GET]);
+        UT_LOG("race: %s done, %lu impossible reads, %lu failed calls", pair->name,
+               total.impossible + alone.impossible, total.failed + alone.failed);
+        impossible += total.impossible + alone.impossible;
+        failed += total.failed + alone.failed;
+    }
+    catch_crashes(0);
+
+    printf("Race run: %llu impossible reads, %llu failed calls\n", impossible, failed);
+    return (impossible != 0 || failed != 0) ? 1 : 0;
+}
+
+static int env_number(const char *name, long *value, long minimum)
+{
+    const char *text = getenv(name);
+    char *end = NULL;
+    long number;
+
+    if (text == NULL || *text == '\0')
+    {
+        return 0;
+    }
+    number = strtol(text, &end, 10);
+    if (*end != '\0' || number < minimum)
+    {
+        return -1;
+    }
+    *value = number;
+    return 0;
+}
+
+int hal_race_init(int *argc, char **argv)
+{
+    int i;
+    int j;
+
+    for (i = 1; i < *argc; i++)
+    {
+        if (strcmp(argv[i], HAL_RACE_ARG) != 0)
+        {
+            continue;
+        }
+        if (i + 1 >= *argc || hal_soak_parse_duration(argv[i + 1], &gDurationS) != 0)
+        {
+            printf("%s must be followed by a duration in seconds, or with an s, m, h or d suffix\n", HAL_RACE_ARG);
+            return -1;
+        }
+        gEnabled = 1;
+        for (j = i; j + 2 <= *argc; j++)
+        {
+            argv[j] = argv[j + 2];
+        }
+        *argc -= 2;
+        i--;
+    }
+    if (!gEnabled)
+    {
+        return 0;
+    }
+
+    if (env_number(HAL_RACE_THREADS_ENV, &gThreads, 2) != 0)
+    {
+        printf("%s must be a number of threads of at least 2\n", HAL_RACE_THREADS_ENV);
+        return -1;
+    }
+    if (env_number(HAL_RACE_TIMEOUT_ENV, &gTimeoutS, 1) != 0)
+    {
+        printf("%s must be a number of seconds\n", HAL_RACE_TIMEOUT_ENV);
+        return -1;
+    }
+    return 0;
+}
+
+int hal_race_enabled(void)
+{
+    return gEnabled;
+}
@@ -0,0 +1,83 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+* @file hal_race.h
+* @brief Concurrent set and get stress mode for the thread safety of the HAL.
+*
+* In the field several RDK-B processes call the platform HAL at the same time.
+* "platform_hal_test --race DURATION" replaces the test run with a stress run, given in
+* seconds or with an s, m, h or d suffix, shared between these pairs:
+* SetSSHEnable/GetSSHEnable, SetTelnetEnable/GetTelnetEnable, SetSNMPEnable/GetSNMPEnable,
+* SetWebUITimeout/GetWebUITimeout, setLed/getLed and, with the thermal manager,
+* setFanSpeed/getFanSpeed on the first configured fan.
+*
+* Each pair is first called from one thread, writing a value and reading it back, to get
+* the latency of the calls alone. Half of the threads then write values from a small set
+* while the other half read. The set is chosen so that a read mixing two writes, such as
+* an LED colour from one setLed call and an interval from another, or a string with the
+* tail of a longer one, is not in it and is counted as an impossible read. A pair whose
+* setter fails when called alone is skipped, and settings other than the fan speed are
+* restored afterwards.
+*
+* A watchdog reports a deadlock when a thread stays inside one HAL call for longer than
+* the timeout, naming the API every thread is in, and the run ends without joining them.
+* A thread that crashes inside the HAL names its API on stderr before the signal takes
+* its normal course. The latency of every API under contention is reported next to its
+* latency alone, with the mean, the 99th percentile as the upper edge of a power of two
+* bucket, and the maximum.
+*
+* | variable                   | meaning                                     | default |
+* | -------------------------- | ------------------------------------------- | ------- |
+* | PLATFORM_HAL_RACE_THREADS  | Threads per pair, at least 2                | 8       |
+* | PLATFORM_HAL_RACE_TIMEOUT  | Seconds in one call before a deadlock       | 10      |
+*/
+
+#ifndef __HAL_RACE_H__
+#define __HAL_RACE_H__
+
+#define HAL_RACE_ARG         "--race"
+#define HAL_RACE_THREADS_ENV "PLATFORM_HAL_RACE_THREADS"
+#define HAL_RACE_TIMEOUT_ENV "PLATFORM_HAL_RACE_TIMEOUT"
+
+#define HAL_RACE_DEFAULT_THREADS   (8)
+#define HAL_RACE_DEFAULT_TIMEOUT_S (10)
+
+/**
+* @brief Take "--race DURATION" out of the command line and read the configuration.
+*
+* The remaining arguments are left for UT_init().
+*
+* @return 0 on success, -1 on an invalid duration or configuration
+*/
+int hal_race_init(int *argc, char **argv);
+
+/**
+* @brief Return non zero when the command line asked for a race run.
+*/
+int hal_race_enabled(void);
+
+/**
+* @brief Run every pair from concurrent threads and report the outcome.
+*
+* @return 0 when every read was possible and no call failed, 1 otherwise, -1 on a
+*         deadlock or when the run could not start
+*/
+int hal_race_run(void);
+
+#endif /* __HAL_RACE_H__ */
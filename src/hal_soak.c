@@ -0,0 +1,540 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+* @file hal_soak.c
+* @brief Soak loop, time series and trend fitting, see hal_soak.h.
+*/
+
+#include <ut.h>
+#include <ut_log.h>
+#include <signal.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include "platform_hal.h"
+#include "hal_arena.h"
+#include "hal_footprint.h"
+#include "hal_log.h"
+#include "hal_soak.h"
+
+#define NS_PER_S    (1000000000ull)
+#define NS_PER_HOUR (3600.0 * 1e9)
+#define MIN_WINDOWS (4)      /* Fitted windows needed for a trend, after the warm-up window */
+#define MIN_R2      (0.5)
+
+typedef struct
+{
+    uint64_t      ns;
+    unsigned long calls;
+} latency_t;
+
+/* Running sums of a least squares fit of y over t, t in hours */
+typedef struct
+{
+    double n;
+    double t;
+    double y;
+    double tt;
+    double ty;
+    double yy;
+    double firstT;
+    double lastT;
+} trend_t;
+
+typedef enum
+{
+    TREND_RATE = 0,   /* Flag a slope above the limit */
+    TREND_GROWTH,     /* Flag a fitted growth over the run of at least the limit */
+    TREND_RELATIVE    /* Flag a slope above the limit in percent of the fitted start */
+} trend_kind_t;
+
+typedef struct
+{
+    hal_api_id_t get;
+    hal_api_id_t set;
+    int (*run)(void);
+} round_trip_t;
+
+static int gEnabled = 0;
+static uint64_t gDurationS = 0;
+static long gWindowS = HAL_SOAK_DEFAULT_WINDOW_S;
+static const char *gFile = HAL_SOAK_DEFAULT_FILE;
+static long gRssDriftKb = HAL_SOAK_DEFAULT_RSS_DRIFT_KB;
+static long gLatencyDrift = HAL_SOAK_DEFAULT_LATENCY_DRIFT;
+static volatile sig_atomic_t gStop = 0;
+
+static latency_t gWindow[HAL_API_COUNT];
+static unsigned char gColumn[HAL_API_COUNT];
+static trend_t gLatency[HAL_API_COUNT];
+static trend_t gRss;
+static trend_t gData;
+static trend_t gFds;
+static trend_t gThreads;
+static unsigned long gWindowCalls = 0;
+static unsigned long gWindowFailures = 0;
+static unsigned long long gTotalCalls = 0;
+static unsigned long long gTotalFailures = 0;
+
+static uint64_t now_ns(void)
+{
+    struct timespec ts;
+
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (uint64_t)ts.tv_sec * NS_PER_S + (uint64_t)ts.tv_nsec;
+}
+
+static void account(hal_api_id_t api, uint64_t ns, unsigned long calls)
+{
+    gWindow[api].ns += ns;
+    gWindow[api].calls += calls;
+    gWindowCalls += calls;
+}
+
+#define TIMED(api, result, call) \
+    do \
+    { \
+        uint64_t start_ = now_ns(); \
+        (result) = (call); \
+        account((api), now_ns() - start_, 1); \
+    } while (0)
+
+/* Read a setting, write the same value back and read it again; v is the value read */
+#define ROUND_TRIP(name, type, getArgs, setArgs) \
+    static int round_trip_##name(void) \
+    { \
+        type v; \
+        type before; \
+        INT result; \
+        memset(&v, 0, sizeof(v)); \
+        TIMED(HAL_API_ID_Get##name, result, platform_hal_Get##name getArgs); \
+        if (result != RETURN_OK) \
+        { \
+            return -1; \
+        } \
+        before = v; \
+        TIMED(HAL_API_ID_Set##name, result, platform_hal_Set##name setArgs); \
+        if (result != RETURN_OK) \
+        { \
+            return -1; \
+        } \
+        memset(&v, 0, sizeof(v)); \
+        TIMED(HAL_API_ID_Get##name, result, platform_hal_Get##name getArgs); \
+        return (result == RETURN_OK && v == before) ? 0 : -1; \
+    }
+
+ROUND_TRIP(SSHEnable, BOOLEAN, (&v), (v))
+ROUND_TRIP(TelnetEnable, BOOLEAN, (&v), (v))
+ROUND_TRIP(WebUITimeout, ULONG, (&v), (v))
+ROUND_TRIP(MACsecEnable, BOOLEAN, (0, &v), (0, v))
+
+static int round_trip_SNMPEnable(void)
+{
+    CHAR before[32] = { '\0' };
+    CHAR after[32] = { '\0' };
+    INT result;
+
+    TIMED(HAL_API_ID_GetSNMPEnable, result, platform_hal_GetSNMPEnable(before));
+    if (result != RETURN_OK)
+    {
+        return -1;
+    }
+    before[sizeof(before) - 1] = '\0';
+    TIMED(HAL_API_ID_SetSNMPEnable, result, platform_hal_SetSNMPEnable(before));
+    if (result != RETURN_OK)
+    {
+        return -1;
+    }
+    TIMED(HAL_API_ID_GetSNMPEnable, result, platform_hal_GetSNMPEnable(after));
+    return (result == RETURN_OK && strncmp(before, after, sizeof(before)) == 0) ? 0 : -1;
+}
+
+static const round_trip_t gRoundTrips[] =
+{
+    { HAL_API_ID_GetSSHEnable, HAL_API_ID_SetSSHEnable, round_trip_SSHEnable },
+    { HAL_API_ID_GetTelnetEnable, HAL_API_ID_SetTelnetEnable, round_trip_TelnetEnable },
+    { HAL_API_ID_GetWebUITimeout, HAL_API_ID_SetWebUITimeout, round_trip_WebUITimeout },
+    { HAL_API_ID_GetSNMPEnable, HAL_API_ID_SetSNMPEnable, round_trip_SNMPEnable },
+    { HAL_API_ID_GetMACsecEnable, HAL_API_ID_SetMACsecEnable, round_trip_MACsecEnable },
+};
+
+#define ROUND_TRIP_COUNT (sizeof(gRoundTrips) / sizeof(gRoundTrips[0]))
+
+static void trend_add(trend_t *trend, double t, double y)
+{
+    if (trend->n == 0)
+    {
+        trend->firstT = t;
+    }
+    trend->lastT = t;
+    trend->n += 1;
+    trend->t += t;
+    trend->y += y;
+    trend->tt += t * t;
+    trend->ty += t * y;
+    trend->yy += y * y;
+}
+
+/* Least squares slope per hour, start value and coefficient of determination */
+static int trend_fit(const trend_t *trend, double *slope, double *start, double *r2)
+{
+    double varT = trend->n * trend->tt - trend->t * trend->t;
+    double varY = trend->n * trend->yy - trend->y * trend->y;
+    double cov = trend->n * trend->ty - trend->t * trend->y;
+
+    if (trend->n < MIN_WINDOWS || varT <= 0)
+    {
+        return -1;
+    }
+    *slope = cov / varT;
+    *start = (trend->y - *slope * trend->t) / trend->n + *slope * trend->firstT;
+    *r2 = (varY > 0) ? (cov * cov) / (varT * varY) : 0;
+    return 0;
+}
+
+/* Print the fit of a series and return 1 if it shows a trend */
+static int report_trend(const char *name, const trend_t *trend, trend_kind_t kind, double limit, int quiet)
+{
+    double slope;
+    double start;
+    double r2;
+    int drift;
+
+    if (trend_fit(trend, &slope, &start, &r2) != 0)
+    {
+        return 0;
+    }
+    switch (kind)
+    {
+        case TREND_GROWTH:
+            drift = slope * (trend->lastT - trend->firstT) >= limit;
+            break;
+        case TREND_RELATIVE:
+            drift = start > 0 && slope * 100.0 / start > limit;
+            break;
+        default:
+            drift = slope > limit;
+            break;
+    }
+    drift = drift && r2 >= MIN_R2;
+    if (drift || !quiet)
+    {
+        printf("%-40s %12.1f %+12.1f %6.2f %s\n", name, start, slope, r2, drift ? "DRIFT" : "");
+    }
+    return drift;
+}
+
+static void close_window(FILE *series, uint64_t elapsedNs, unsigned long window)
+{
+    hal_footprint_t footprint;
+    double hours = elapsedNs / NS_PER_HOUR;
+    int api;
+
+    hal_footprint_sample(&footprint);
+    fprintf(series, "%llu,%lu,%lu,%ld,%ld,%ld,%ld", (unsigned long long)(elapsedNs / NS_PER_S), gWindowCalls,
+            gWindowFailures, footprint.rssKb, footprint.dataKb, footprint.fds, footprint.threads);
+    for (api = 0; api < HAL_API_COUNT; api++)
+    {
+        if (!gColumn[api])
+        {
+            continue;
+        }
+        if (gWindow[api].calls != 0)
+        {
+            fprintf(series, ",%.1f", gWindow[api].ns / 1000.0 / gWindow[api].calls);
+        }
+        else
+        {
+            fputc(',', series);
+        }
+    }
+    fputc('\n', series);
+    fflush(series);
+
+    /* The first window carries the warm-up of caches and lazy HAL initialisation */
+    if (window > 0)
+    {
+        trend_add(&gRss, hours, footprint.rssKb);
+        trend_add(&gData, hours, footprint.dataKb);
+        trend_add(&gFds, hours, footprint.fds);
+        trend_add(&gThreads, hours, footprint.threads);
+        for (api = 0; api < HAL_API_COUNT; api++)
+        {
+            if (gWindow[api].calls != 0)
+            {
+                trend_add(&gLatency[api], hours, gWindow[api].ns / 1000.0 / gWindow[api].calls);
+            }
+        }
+    }
+    UT_LOG("soak: %llu s, %lu calls, %lu failed, rss %ld kB, fds %ld, threads %ld",
+           (unsigned long long)(elapsedNs / NS_PER_S), gWindowCalls, gWindowFailures,
+           footprint.rssKb, footprint.fds, footprint.threads);
+
+    gTotalCalls += gWindowCalls;
+    gTotalFailures += gWindowFailures;
+    gWindowCalls = 0;
+    gWindowFailures = 0;
+    memset(gWindow, 0, sizeof(gWindow));
+}
+
+static int print_summary(uint64_t elapsedNs, unsigned long windows)
+{
+    char name[64];
+    int drift = 0;
+    int api;
+
+    printf("\nSoak run of %llu s: %lu windows, %llu calls, %llu failed\n", (unsigned long long)(elapsedNs / NS_PER_S),
+           windows, gTotalCalls, gTotalFailures);
+    if (gRss.n < MIN_WINDOWS)
+    {
+        printf("Too few windows to fit a trend, %d are needed after the first\n", MIN_WINDOWS);
+        return 0;
+    }
+    printf("%-40s %12s %12s %6s\n", "series", "start", "per hour", "r2");
+    drift += report_trend("rss kB", &gRss, TREND_RATE, gRssDriftKb, 0);
+    drift += report_trend("data kB", &gData, TREND_RATE, gRssDriftKb, 0);
+    drift += report_trend("fds", &gFds, TREND_GROWTH, 1, 0);
+    drift += report_trend("threads", &gThreads, TREND_GROWTH, 1, 0);
+    for (api = 0; api < HAL_API_COUNT; api++)
+    {
+        if (gColumn[api])
+        {
+            snprintf(name, sizeof(name), "%s us", hal_case_api_name(api));
+            drift += report_trend(name, &gLatency[api], TREND_RELATIVE, gLatencyDrift, 1);
+        }
+    }
+    printf("%s\n", drift ? "Drift found, see the series marked DRIFT" : "No drift found");
+    return drift;
+}
+
+static void stop(int signal)
+{
+    (void)signal;
+    gStop = 1;
+}
+
+static int is_getter(const hal_case_t *test)
+{
+    const char *name = hal_case_api_name(test->api);
+
+    return name != NULL && (strncmp(name, "Get", 3) == 0 || strncmp(name, "get", 3) == 0);
+}
+
+int hal_soak_run(const hal_case_t *cases, size_t count)
+{
+    const hal_case_t **getters;
+    struct sigaction action;
+    FILE *series;
+    uint64_t start;
+    uint64_t end;
+    uint64_t windowEnd;
+    uint64_t now;
+    unsigned long windows = 0;
+    size_t getterCount = 0;
+    size_t calls;
+    size_t i;
+    long failures;
+    int drift;
+    int api;
+
+    getters = malloc(count * sizeof(*getters));
+    if (getters == NULL)
+    {
+        printf("hal_soak: out of memory\n");
+        return -1;
+    }
+    for (i = 0; i < count; i++)
+    {
+        if (is_getter(&cases[i]))
+        {
+            getters[getterCount++] = &cases[i];
+            gColumn[cases[i].api] = 1;
+        }
+    }
+    for (i = 0; i < ROUND_TRIP_COUNT; i++)
+    {
+        gColumn[gRoundTrips[i].get] = 1;
+        gColumn[gRoundTrips[i].set] = 1;
+    }
+
+    series = fopen(gFile, "w");
+    if (series == NULL)
+    {
+        printf("hal_soak: cannot create %s\n", gFile);
+        free(getters);
+        return -1;
+    }
+    fprintf(series, "seconds,calls,failures,rss_kb,data_kb,fds,threads");
+    for (api = 0; api < HAL_API_COUNT; api++)
+    {
+        if (gColumn[api])
+        {
+            fprintf(series, ",%s_us", hal_case_api_name(api));
+        }
+    }
+    fputc('\n', series);
+
+    memset(&action, 0, sizeof(action));
+    action.sa_handler = stop;
+    sigemptyset(&action.sa_mask);
+    sigaction(SIGINT, &action, NULL);
+    sigaction(SIGTERM, &action, NULL);
+
+    printf("Soak run of %llu s over %zu getter cases and %zu round trips, %ld s windows written to %s\n",
+           (unsigned long long)gDurationS, getterCount, ROUND_TRIP_COUNT, gWindowS, gFile);
+    start = now_ns();
+    end = start + gDurationS * NS_PER_S;
+    windowEnd = start + (uint64_t)gWindowS * NS_PER_S;
+    do
+    {
+        for (i = 0; i < getterCount && !gStop; i++)
+        {
+            now = now_ns();
+            failures = hal_case_call(getters[i], &calls);
+            account(getters[i]->api, now_ns() - now, calls);
+            gWindowFailures += (failures < 0) ? 1 : (unsigned long)failures;
+        }
+        for (i = 0; i < ROUND_TRIP_COUNT && !gStop; i++)
+        {
+            if (gRoundTrips[i].run() != 0)
+            {
+                gWindowFailures++;
+            }
+        }
+        hal_arena_reset();
+
+        now = now_ns();
+        if (now >= windowEnd || now >= end || gStop)
+        {
+            close_window(series, now - start, windows++);
+            windowEnd = now + (uint64_t)gWindowS * NS_PER_S;
+        }
+    } while (!gStop && now < end);
+
+    fclose(series);
+    free(getters);
+    drift = print_summary(now - start, windows);
+    return (drift != 0 || gTotalFailures != 0) ? 1 : 0;
+}
+
+int hal_soak_parse_duration(const char *text, uint64_t *seconds)
+{
+    unsigned long long value;
+    uint64_t unit;
+    char *end = NULL;
+
+    if (text == NULL || *text < '0' || *text > '9')
+    {
+        return -1;
+    }
+    value = strtoull(text, &end, 10);
+    switch (*end)
+    {
+        case '\0':
+        case 's': unit = 1; break;
+        case 'm': unit = 60; break;
+        case 'h': unit = 3600; break;
+        case 'd': unit = 86400; break;
+        default: return -1;
+    }
+    if ((*end != '\0' && end[1] != '\0') || value == 0)
+    {
+        return -1;
+    }
+    *seconds = value * unit;
+    return 0;
+}
+
+static int env_number(const char *name, long *value)
+{
+    const char *text = getenv(name);
+    char *end = NULL;
+    long number;
+
+    if (text == NULL || *text == '\0')
+    {
+        return 0;
+    }
+    number = strtol(text, &end, 10);
+    if (*end != '\0' || number <= 0)
+    {
+        return -1;
+    }
+    *value = number;
+    return 0;
+}
+
+int hal_soak_init(int *argc, char **argv)
+{
+    const char *file = getenv(HAL_SOAK_FILE_ENV);
+    int i;
+    int j;
+
+    for (i = 1; i < *argc; i++)
+    {
+        if (strcmp(argv[i], HAL_SOAK_ARG) != 0)
+        {
+            continue;
+        }
+        if (i + 1 >= *argc || hal_soak_parse_duration(argv[i + 1], &gDurationS) != 0)
+        {
+            printf("%s must be followed by a duration in seconds, or with an s, m, h or d suffix\n", HAL_SOAK_ARG);
+            return -1;
+        }
+        gEnabled = 1;
+        /* Shift the rest down, argv[argc] included */
+        for (j = i; j + 2 <= *argc; j++)
+        {
+            argv[j] = argv[j + 2];
+        }
+        *argc -= 2;
+        i--;
+    }
+    if (!gEnabled)
+    {
+        return 0;
+    }
+
+    if (env_number(HAL_SOAK_WINDOW_ENV, &gWindowS) != 0)
+    {
+        printf("%s must be a number of seconds\n", HAL_SOAK_WINDOW_ENV);
+        return -1;
+    }
+    if (env_number(HAL_SOAK_RSS_DRIFT_ENV, &gRssDriftKb) != 0)
+    {
+        printf("%s must be a number of KiB per hour\n", HAL_SOAK_RSS_DRIFT_ENV);
+        return -1;
+    }
+    if (env_number(HAL_SOAK_LATENCY_DRIFT_ENV, &gLatencyDrift) != 0)
+    {
+        printf("%s must be a percentage per hour\n", HAL_SOAK_LATENCY_DRIFT_ENV);
+        return -1;
+    }
+    if (file != NULL && *file != '\0')
+    {
+        gFile = file;
+    }
+    return 0;
+}
+
+int hal_soak_enabled(void)
+{
+    return gEnabled;
+}
@@ -0,0 +1,96 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+* @file hal_soak.h
+* @brief Long running soak mode with drift detection.
+*
+* "platform_hal_test --soak DURATION" replaces the test run with a loop lasting DURATION,
+* given in seconds or with an s, m, h or d suffix (e.g. 90m, 8h). Each pass runs the table
+* driven L1 cases of the getters, then round trips that read a setting and write the same
+* value back. The loop stops early on SIGINT or SIGTERM.
+*
+* Time is cut into windows. At the end of each window one line is appended to a CSV time
+* series: elapsed seconds, calls, failed calls, resident set, data segment, open file
+* descriptors, threads, and the mean latency of every API in microseconds.
+*
+* When the loop ends a least squares line is fitted to every series, leaving out the first
+* window as warm-up. A trend is reported when the fit explains at least half of the
+* variance and one of these holds:
+* - The resident set or the data segment grows faster than the RSS drift.
+* - File descriptors or threads grow by at least one over the run.
+* - An API's latency grows faster than the latency drift, relative to its fitted start.
+*
+* | variable                        | meaning                                   | default               |
+* | ------------------------------- | ----------------------------------------- | --------------------- |
+* | PLATFORM_HAL_SOAK_WINDOW        | Window length in seconds                  | 60                    |
+* | PLATFORM_HAL_SOAK_FILE          | Time series file                          | platform_hal_soak.csv |
+* | PLATFORM_HAL_SOAK_RSS_DRIFT     | Tolerated memory growth in KiB per hour   | 256                   |
+* | PLATFORM_HAL_SOAK_LATENCY_DRIFT | Tolerated latency growth in % per hour    | 10                    |
+*/
+
+#ifndef __HAL_SOAK_H__
+#define __HAL_SOAK_H__
+
+#include <stddef.h>
+#include <stdint.h>
+#include "hal_case.h"
+
+#define HAL_SOAK_ARG               "--soak"
+#define HAL_SOAK_WINDOW_ENV        "PLATFORM_HAL_SOAK_WINDOW"
+#define HAL_SOAK_FILE_ENV          "PLATFORM_HAL_SOAK_FILE"
+#define HAL_SOAK_RSS_DRIFT_ENV     "PLATFORM_HAL_SOAK_RSS_DRIFT"
+#define HAL_SOAK_LATENCY_DRIFT_ENV "PLATFORM_HAL_SOAK_LATENCY_DRIFT"
+
+#define HAL_SOAK_DEFAULT_WINDOW_S      (60)
+#define HAL_SOAK_DEFAULT_FILE          "platform_hal_soak.csv"
+#define HAL_SOAK_DEFAULT_RSS_DRIFT_KB  (256)
+#define HAL_SOAK_DEFAULT_LATENCY_DRIFT (10)
+
+/**
+* @brief Take "--soak DURATION" out of the command line and read the configuration.
+*
+* The remaining arguments are left for UT_init().
+*
+* @return 0 on success, -1 on an invalid duration or configuration
+*/
+int hal_soak_init(int *argc, char **argv);
+
+/**
+* @brief Parse a duration given in seconds or with an s, m, h or d suffix.
+*
+* @param[in]  text    - Duration, e.g. "90", "90m" or "8h"
+* @param[out] seconds - Duration in seconds
+*
+* @return 0 on success, -1 when the text is not a positive duration
+*/
+int hal_soak_parse_duration(const char *text, uint64_t *seconds);
+
+/**
+* @brief Return non zero when the command line asked for a soak run.
+*/
+int hal_soak_enabled(void);
+
+/**
+* @brief Run the soak loop over the getter cases of a table.
+*
+* @return 0 when no call failed and no trend was found, 1 otherwise, -1 if the run could not start
+*/
+int hal_soak_run(const hal_case_t *cases, size_t count);
+
+#endif /* __HAL_SOAK_H__ */
@@ -0,0 +1,773 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+* @file hal_trace.c
+* @brief Record and replay hooks for the HAL interposer, see hal_trace.h for the format.
+*/
+
+#ifdef HAL_INTERPOSE
+
+#include <ut_log.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <errno.h>
+#include <fcntl.h>
+#include <unistd.h>
+#include <pthread.h>
+#include <sys/stat.h>
+#include "hal_interpose.h"
+#include "hal_trace.h"
+#include "hal_log.h"
+
+#define TRACE_MAGIC          "HALTRACE"
+#define TRACE_MAGIC_LENGTH   (8)
+#define TRACE_VERSION        (1)
+#define TRACE_SESSION        (1)
+#define TRACE_API            (2)
+#define TRACE_CALL           (3)
+#define TAG_NULL             (0)
+#define TAG_ABSENT           (1)
+#define TAG_DATA             (2)
+#define MAX_STRING           (4096)
+#define MAX_DHCP_NODES       (256)
+#define MAX_TRACE_ARGS       (4)
+#define MAX_TRACE_API_IDS    (256)
+
+typedef struct
+{
+    uint8_t *data;
+    size_t   length;
+    size_t   size;
+    int      failed;
+} trace_buffer_t;
+
+typedef struct
+{
+    hal_arg_kind_t kind;
+    long long      value;
+    uint64_t       tag;
+    const uint8_t *data;
+    size_t         length;
+} trace_arg_t;
+
+typedef struct
+{
+    uint64_t    durationNs;
+    long long   ret;
+    int         argCount;
+    trace_arg_t args[MAX_TRACE_ARGS];
+} trace_call_t;
+
+typedef struct
+{
+    trace_call_t *calls;
+    size_t        count;
+    size_t        size;
+    size_t        cursor;
+} trace_api_t;
+
+static pthread_mutex_t gTraceLock = PTHREAD_MUTEX_INITIALIZER;
+static int gRecordFd = -1;
+static uint64_t gSessionStartNs;
+static uint8_t gApiDefined[HAL_API_COUNT];
+static uint8_t *gReplayData = NULL;
+static trace_api_t gReplay[HAL_API_COUNT];
+static double gTimingScale = 0;
+static unsigned long gReplayServed = 0;
+static unsigned long gReplayMissed = 0;
+
+/* Encoding */
+
+static void put_byte(trace_buffer_t *buf, uint8_t byte)
+{
+    if (buf->length == buf->size)
+    {
+        size_t size = buf->size ? buf->size * 2 : 256;
+        uint8_t *data = (uint8_t *)realloc(buf->data, size);
+
+        if (data == NULL)
+        {
+            buf->failed = 1;
+            return;
+        }
+        buf->data = data;
+        buf->size = size;
+    }
+    buf->data[buf->length++] = byte;
+}
+
+static void put_varint(trace_buffer_t *buf, uint64_t value)
+{
+    while (value >= 0x80)
+    {
+        put_byte(buf, (uint8_t)(value | 0x80));
+        value >>= 7;
+    }
+    put_byte(buf, (uint8_t)value);
+}
+
+static void put_svarint(trace_buffer_t *buf, long long value)
+{
+    put_varint(buf, ((uint64_t)value << 1) ^ (uint64_t)(value >> 63));
+}
+
+static void put_blob(trace_buffer_t *buf, const void *ptr, size_t length, int captured)
+{
+    size_t i;
+
+    if (ptr == NULL)
+    {
+        put_varint(buf, TAG_NULL);
+        return;
+    }
+    if (!captured)
+    {
+        put_varint(buf, TAG_ABSENT);
+        return;
+    }
+    put_varint(buf, (uint64_t)length + TAG_DATA);
+    for (i = 0; i < length; i++)
+    {
+        put_byte(buf, ((const uint8_t *)ptr)[i]);
+    }
+}
+
+static size_t trimmed_length(const void *ptr, size_t size)
+{
+    const uint8_t *bytes = (const uint8_t *)ptr;
+
+    while (ptr != NULL && size > 0 && bytes[size - 1] == 0)
+    {
+        size--;
+    }
+    return size;
+}
+
+static size_t string_length(const void *ptr)
+{
+    return (ptr != NULL) ? strnlen((const char *)ptr, MAX_STRING) : 0;
+}
+
+static void put_dhcp(trace_buffer_t *buf, dhcp_opt_list **list, int captured)
+{
+    dhcp_opt_list *node;
+    uint64_t count = 0;
+
+    if (list == NULL)
+    {
+        put_varint(buf, TAG_NULL);
+        return;
+    }
+    if (!captured)
+    {
+        put_varint(buf, TAG_ABSENT);
+        return;
+    }
+    for (node = *list; node != NULL && count < MAX_DHCP_NODES; node = node->next)
+    {
+        count++;
+    }
+    put_varint(buf, count + TAG_DATA);
+    for (node = *list; count > 0; node = node->next, count--)
+    {
+        put_varint(buf, node->dhcp_opt);
+        put_blob(buf, node->dhcp_opt_val, string_length(node->dhcp_opt_val), 1);
+    }
+}
+
+static void put_arg(trace_buffer_t *buf, const hal_arg_t *arg, int captured)
+{
+    void *inner;
+
+    put_varint(buf, (uint64_t)arg->kind);
+    switch (arg->kind)
+    {
+        case HAL_ARG_KIND_VALUE:
+            put_svarint(buf, arg->value);
+            break;
+        case HAL_ARG_KIND_STR_IN:
+            put_blob(buf, arg->ptr, string_length(arg->ptr), 1);
+            break;
+        case HAL_ARG_KIND_STR_OUT:
+            put_blob(buf, arg->ptr, captured ? string_length(arg->ptr) : 0, captured);
+            break;
+        case HAL_ARG_KIND_MEM_IN:
+            put_blob(buf, arg->ptr, trimmed_length(arg->ptr, arg->size), 1);
+            break;
+        case HAL_ARG_KIND_MEM_OUT:
+            /* Structures have a known size, so they are kept even for failed calls (error reasons) */
+            put_blob(buf, arg->ptr, trimmed_length(arg->ptr, arg->size), 1);
+            break;
+        case HAL_ARG_KIND_MEM_OUT_REF:
+            inner = (arg->ptr != NULL) ? *(void **)arg->ptr : NULL;
+            put_blob(buf, inner, trimmed_length(inner, arg->size), 1);
+            break;
+        case HAL_ARG_KIND_DHCP_OUT:
+            put_dhcp(buf, (dhcp_opt_list **)arg->ptr, captured);
+            break;
+        default:
+            break;
+    }
+}
+
+static void write_all(int fd, const uint8_t *data, size_t length)
+{
+    while (length > 0)
+    {
+        ssize_t written = write(fd, data, length);
+
+        if (written < 0)
+        {
+            if (errno == EINTR)
+            {
+                continue;
+            }
+            return;
+        }
+        data += written;
+        length -= (size_t)written;
+    }
+}
+
+/* Recording */
+
+static void record_end(hal_call_t *call)
+{
+    trace_buffer_t buf;
+    trace_buffer_t def;
+    int captured = (call->retKind == HAL_RET_VALUE || call->ret == RETURN_OK);
+    int i;
+
+    memset(&buf, 0, sizeof(buf));
+    memset(&def, 0, sizeof(def));
+    put_varint(&buf, TRACE_CALL);
+    put_varint(&buf, (uint64_t)call->id);
+    put_varint(&buf, (call->startNs > gSessionStartNs) ? call->startNs - gSessionStartNs : 0);
+    put_varint(&buf, call->endNs - call->startNs);
+    put_svarint(&buf, call->ret);
+    put_varint(&buf, (uint64_t)call->argCount);
+    for (i = 0; i < call->argCount; i++)
+    {
+        put_arg(&buf, &call->args[i], captured);
+    }
+
+    pthread_mutex_lock(&gTraceLock);
+    if (!gApiDefined[call->id])
+    {
+        gApiDefined[call->id] = 1;
+        put_varint(&def, TRACE_API);
+        put_varint(&def, (uint64_t)call->id);
+        put_blob(&def, call->api, strlen(call->api), 1);
+        if (!def.failed)
+        {
+            write_all(gRecordFd, def.data, def.length);
+        }
+    }
+    if (!buf.failed)
+    {
+        write_all(gRecordFd, buf.data, buf.length);
+    }
+    pthread_mutex_unlock(&gTraceLock);
+    free(def.data);
+    free(buf.data);
+}
+
+static const hal_interpose_hook_t gRecordHook =
+{
+    .name = "record",
+    .begin = NULL,
+    .end = record_end,
+};
+
+static int start_recording(const char *path)
+{
+    trace_buffer_t buf;
+    struct stat info;
+
+    gRecordFd = open(path, O_WRONLY | O_CREAT | O_APPEND | O_CLOEXEC, 0644);
+    if (gRecordFd < 0 || fstat(gRecordFd, &info) != 0)
+    {
+        printf("Failed to open HAL trace %s\n", path);
+        return -1;
+    }
+    memset(&buf, 0, sizeof(buf));
+    if (info.st_size == 0)
+    {
+        size_t i;
+
+        for (i = 0; i < TRACE_MAGIC_LENGTH; i++)
+        {
+            put_byte(&buf, (uint8_t)TRACE_MAGIC[i]);
+        }
+        put_byte(&buf, TRACE_VERSION);
+    }
+    put_varint(&buf, TRACE_SESSION);
+    put_varint(&buf, (uint64_t)time(NULL));
+    put_varint(&buf, (uint64_t)getpid());
+    if (buf.failed)
+    {
+        free(buf.data);
+        return -1;
+    }
+    gSessionStartNs = hal_interpose_now_ns();
+    write_all(gRecordFd, buf.data, buf.length);
+    free(buf.data);
+    UT_LOG("recording HAL calls to %s", path);
+    return hal_interpose_register(&gRecordHook);
+}
+
+/* Replay */
+
+static int get_varint(const uint8_t **p, const uint8_t *end, uint64_t *value)
+{
+    int shift = 0;
+
+    *value = 0;
+    while (*p < end && shift < 64)
+    {
+        uint8_t byte = *(*p)++;
+
+        *value |= (uint64_t)(byte & 0x7F) << shift;
+        if (!(byte & 0x80))
+        {
+            return 0;
+        }
+        shift += 7;
+    }
+    return -1;
+}
+
+static int get_svarint(const uint8_t **p, const uint8_t *end, long long *value)
+{
+    uint64_t raw;
+
+    if (get_varint(p, end, &raw) != 0)
+    {
+        return -1;
+    }
+    *value = (long long)((raw >> 1) ^ (~(raw & 1) + 1));
+    return 0;
+}
+
+static int get_blob(const uint8_t **p, const uint8_t *end, trace_arg_t *arg)
+{
+    if (get_varint(p, end, &arg->tag) != 0)
+    {
+        return -1;
+    }
+    arg->data = *p;
+    arg->length = (arg->tag >= TAG_DATA) ? (size_t)(arg->tag - TAG_DATA) : 0;
+    if ((size_t)(end - *p) < arg->length)
+    {
+        return -1;
+    }
+    *p += arg->length;
+    return 0;
+}
+
+static int get_dhcp(const uint8_t **p, const uint8_t *end, trace_arg_t *arg)
+{
+    trace_arg_t value;
+    uint64_t count;
+    uint64_t option;
+
+    if (get_varint(p, end, &arg->tag) != 0)
+    {
+        return -1;
+    }
+    arg->data = *p;
+    for (count = (arg->tag >= TAG_DATA) ? arg->tag - TAG_DATA : 0; count > 0; count--)
+    {
+        if (get_varint(p, end, &option) != 0 || get_blob(p, end, &value) != 0)
+        {
+            return -1;
+        }
+    }
+    arg->length = (size_t)(*p - arg->data);
+    return 0;
+}
+
+static int get_call(const uint8_t **p, const uint8_t *end, trace_call_t *call)
+{
+    uint64_t startNs;
+    uint64_t count;
+    uint64_t kind;
+    int i;
+
+    memset(call, 0, sizeof(*call));
+    if (get_varint(p, end, &startNs) != 0 || get_varint(p, end, &call->durationNs) != 0 ||
+        get_svarint(p, end, &call->ret) != 0 || get_varint(p, end, &count) != 0 || count > MAX_TRACE_ARGS)
+    {
+        return -1;
+    }
+    call->argCount = (int)count;
+    for (i = 0; i < call->argCount; i++)
+    {
+        trace_arg_t *arg = &call->args[i];
+        int status;
+
+        if (get_varint(p, end, &kind) != 0)
+        {
+            return -1;
+        }
+        arg->kind = (hal_arg_kind_t)kind;
+        switch (arg->kind)
+        {
+            case HAL_ARG_KIND_VALUE:
+                status = get_svarint(p, end, &arg->value);
+                break;
+            case HAL_ARG_KIND_DHCP_OUT:
+                status = get_dhcp(p, end, arg);
+                break;
+            default:
+                status = get_blob(p, end, arg);
+                break;
+        }
+        if (status != 0)
+        {
+            return -1;
+        }
+    }
+    return 0;
+}
+
+static int add_replay_call(hal_api_id_t id, const trace_call_t *call)
+{
+    trace_api_t *api = &gReplay[id];
+
+    if (api->count == api->size)
+    {
+        size_t size = api->size ? api->size * 2 : 16;
+        trace_call_t *calls = (trace_call_t *)realloc(api->calls, size * sizeof(trace_call_t));
+
+        if (calls == NULL)
+        {
+            return -1;
+        }
+        api->calls = calls;
+        api->size = size;
+    }
+    api->calls[api->count++] = *call;
+    return 0;
+}
+
+static int load_trace(const uint8_t *p, const uint8_t *end)
+{
+    hal_api_id_t ids[MAX_TRACE_API_IDS];
+    trace_call_t call;
+    trace_arg_t name;
+    uint64_t type;
+    uint64_t id;
+    uint64_t ignored;
+    char apiName[128];
+    int i;
+
+    for (i = 0; i < MAX_TRACE_API_IDS; i++)
+    {
+        ids[i] = HAL_API_COUNT;
+    }
+    while (p < end)
+    {
+        if (get_varint(&p, end, &type) != 0)
+        {
+            return -1;
+        }
+        switch (type)
+        {
+            case TRACE_SESSION:
+                for (i = 0; i < MAX_TRACE_API_IDS; i++)
+                {
+                    ids[i] = HAL_API_COUNT;
+                }
+                if (get_varint(&p, end, &ignored) != 0 || get_varint(&p, end, &ignored) != 0)
+                {
+                    return -1;
+                }
+                break;
+            case TRACE_API:
+                if (get_varint(&p, end, &id) != 0 || get_blob(&p, end, &name) != 0 ||
+                    id >= MAX_TRACE_API_IDS || name.length >= sizeof(apiName))
+                {
+                    return -1;
+                }
+                memcpy(apiName, name.data, name.length);
+                apiName[name.length] = '\0';
+                ids[id] = hal_interpose_find_api(apiName);
+                break;
+            case TRACE_CALL:
+                if (get_varint(&p, end, &id) != 0 || id >= MAX_TRACE_API_IDS || get_call(&p, end, &call) != 0)
+                {
+                    return -1;
+                }
+                /* Calls of APIs this build does not have are skipped */
+                if (ids[id] != HAL_API_COUNT && add_replay_call(ids[id], &call) != 0)
+                {
+                    return -1;
+                }
+                break;
+            default:
+                return -1;
+        }
+    }
+    return 0;
+}
+
+static int match_arg(const hal_arg_t *arg, const trace_arg_t *recorded)
+{
+    size_t length;
+
+    if (arg->kind != recorded->kind)
+    {
+        return 0;
+    }
+    switch (arg->kind)
+    {
+        case HAL_ARG_KIND_VALUE:
+            return arg->value == recorded->value;
+        case HAL_ARG_KIND_STR_IN:
+        case HAL_ARG_KIND_MEM_IN:
+            if (arg->ptr == NULL || recorded->tag == TAG_NULL)
+            {
+                return (arg->ptr == NULL && recorded->tag == TAG_NULL);
+            }
+            length = (arg->kind == HAL_ARG_KIND_STR_IN) ? string_length(arg->ptr) : trimmed_length(arg->ptr, arg->size);
+            return (recorded->tag >= TAG_DATA && length == recorded->length &&
+                    !memcmp(arg->ptr, recorded->data, length));
+        case HAL_ARG_KIND_MEM_OUT_REF:
+            return ((arg->ptr == NULL || *(void **)arg->ptr == NULL) == (recorded->tag == TAG_NULL));
+        default:
+            return ((arg->ptr == NULL) == (recorded->tag == TAG_NULL));
+    }
+}
+
+static const trace_call_t *find_replay_call(const hal_call_t *call)
+{
+    trace_api_t *api = &gReplay[call->id];
+    size_t n;
+
+    /* Prefer the next unused recording in order, then allow a recording to be reused */
+    for (n = 0; n < api->count; n++)
+    {
+        size_t index = (api->cursor + n) % api->count;
+        const trace_call_t *recorded = &api->calls[index];
+        int i;
+
+        if (recorded->argCount != call->argCount)
+        {
+            continue;
+        }
+        for (i = 0; i < call->argCount && match_arg(&call->args[i], &recorded->args[i]); i++)
+        {
+        }
+        if (i == call->argCount)
+        {
+            if (index >= api->cursor)
+            {
+                api->cursor = index + 1;
+            }
+            return recorded;
+        }
+    }
+    return NULL;
+}
+
+static dhcp_opt_list *build_dhcp(const trace_arg_t *recorded)
+{
+    const uint8_t *p = recorded->data;
+    const uint8_t *end = recorded->data + recorded->length;
+    dhcp_opt_list *head = NULL;
+    dhcp_opt_list **tail = &head;
+    uint64_t count = recorded->tag - TAG_DATA;
+
+    for (; count > 0; count--)
+    {
+        dhcp_opt_list *node = (dhcp_opt_list *)calloc(1, sizeof(dhcp_opt_list));
+        trace_arg_t value;
+        uint64_t option;
+
+        if (node == NULL || get_varint(&p, end, &option) != 0 || get_blob(&p, end, &value) != 0)
+        {
+            free(node);
+            break;
+        }
+        node->dhcp_opt = (UINT)option;
+        if (value.tag >= TAG_DATA)
+        {
+            node->dhcp_opt_val = (char *)malloc(value.length + 1);
+            if (node->dhcp_opt_val != NULL)
+            {
+                memcpy(node->dhcp_opt_val, value.data, value.length);
+                node->dhcp_opt_val[value.length] = '\0';
+            }
+        }
+        *tail = node;
+        tail = &node->next;
+    }
+    return head;
+}
+
+static void fill_outputs(hal_call_t *call, const trace_call_t *recorded)
+{
+    int i;
+
+    for (i = 0; i < call->argCount; i++)
+    {
+        hal_arg_t *arg = &call->args[i];
+        const trace_arg_t *value = &recorded->args[i];
+        void *target = arg->ptr;
+
+        if (value->tag < TAG_DATA || arg->ptr == NULL)
+        {
+            continue;
+        }
+        switch (arg->kind)
+        {
+            case HAL_ARG_KIND_STR_OUT:
+                memcpy(target, value->data, value->length);
+                ((char *)target)[value->length] = '\0';
+                break;
+            case HAL_ARG_KIND_MEM_OUT_REF:
+                target = *(void **)arg->ptr;
+                /* fall through */
+            case HAL_ARG_KIND_MEM_OUT:
+                memset(target, 0, arg->size);
+                memcpy(target, value->data, (value->length < arg->size) ? value->length : arg->size);
+                break;
+            case HAL_ARG_KIND_DHCP_OUT:
+                *(dhcp_opt_list **)arg->ptr = build_dhcp(value);
+                break;
+            default:
+                break;
+        }
+    }
+}
+
+static void replay_begin(hal_call_t *call)
+{
+    const trace_call_t *recorded;
+
+    pthread_mutex_lock(&gTraceLock);
+    recorded = find_replay_call(call);
+    if (recorded == NULL)
+    {
+        gReplayMissed++;
+        pthread_mutex_unlock(&gTraceLock);
+        UT_LOG("replay: no recorded call of platform_hal_%s matches the arguments", call->api);
+        call->ret = (call->retKind == HAL_RET_STATUS) ? RETURN_ERR : 0;
+        call->skip = 1;
+        return;
+    }
+    gReplayServed++;
+    pthread_mutex_unlock(&gTraceLock);
+
+    fill_outputs(call, recorded);
+    call->ret = recorded->ret;
+    call->skip = 1;
+    if (gTimingScale > 0)
+    {
+        uint64_t ns = (uint64_t)((double)recorded->durationNs * gTimingScale);
+        struct timespec ts;
+
+        ts.tv_sec = (time_t)(ns / 1000000000ull);
+        ts.tv_nsec = (long)(ns % 1000000000ull);
+        while (nanosleep(&ts, &ts) != 0 && errno == EINTR)
+        {
+        }
+    }
+}
+
+static void print_replay_summary(void)
+{
+    printf("\nReplayed HAL calls: %lu served, %lu without a matching recording\n", gReplayServed, gReplayMissed);
+}
+
+static const hal_interpose_hook_t gReplayHook =
+{
+    .name = "replay",
+    .begin = replay_begin,
+    .end = NULL,
+};
+
+static int start_replay(const char *path)
+{
+    const char *timing = getenv(HAL_TRACE_TIMING_ENV);
+    FILE *file = fopen(path, "rb");
+    long length = 0;
+
+    if (file == NULL)
+    {
+        printf("Failed to open HAL trace %s\n", path);
+        return -1;
+    }
+    if (fseek(file, 0, SEEK_END) == 0 && (length = ftell(file)) > TRACE_MAGIC_LENGTH && fseek(file, 0, SEEK_SET) == 0)
+    {
+        gReplayData = (uint8_t *)malloc((size_t)length);
+        if (gReplayData != NULL && fread(gReplayData, 1, (size_t)length, file) != (size_t)length)
+        {
+            free(gReplayData);
+            gReplayData = NULL;
+        }
+    }
+    fclose(file);
+    if (gReplayData == NULL || memcmp(gReplayData, TRACE_MAGIC, TRACE_MAGIC_LENGTH) != 0 ||
+        gReplayData[TRACE_MAGIC_LENGTH] != TRACE_VERSION)
+    {
+        printf("%s is not a HAL trace\n", path);
+        return -1;
+    }
+    if (load_trace(gReplayData + TRACE_MAGIC_LENGTH + 1, gReplayData + length) != 0)
+    {
+        printf("%s is truncated or corrupt\n", path);
+        return -1;
+    }
+    gTimingScale = (timing != NULL) ? atof(timing) : 0;
+    UT_LOG("replaying HAL calls from %s, timing scale %.2f", path, gTimingScale);
+    atexit(print_replay_summary);
+    return hal_interpose_register(&gReplayHook);
+}
+
+int hal_trace_init(void)
+{
+    const char *record = getenv(HAL_TRACE_RECORD_ENV);
+    const char *replay = getenv(HAL_TRACE_REPLAY_ENV);
+
+    if (record != NULL && replay != NULL)
+    {
+        printf("%s and %s cannot be used together\n", HAL_TRACE_RECORD_ENV, HAL_TRACE_REPLAY_ENV);
+        return -1;
+    }
+    if (record != NULL)
+    {
+        return start_recording(record);
+    }
+    if (replay != NULL)
+    {
+        return start_replay(replay);
+    }
+    return 0;
+}
+
+int hal_trace_replaying(void)
+{
+    return gReplayData != NULL;
+}
+
+#endif /* HAL_INTERPOSE */
@@ -0,0 +1,65 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+* @file hal_trace.h
+* @brief Record and replay of platform_hal_* calls on top of the HAL interposer.
+*
+* With PLATFORM_HAL_RECORD=<file> every call made by the suite is appended to a binary
+* trace: API, arguments, output buffers, return code and timing. With
+* PLATFORM_HAL_REPLAY=<file> the calls are answered from such a trace instead of the HAL,
+* so the suite can run against the recorded behaviour of a device with none attached.
+* PLATFORM_HAL_REPLAY_TIMING=<scale> additionally sleeps for the recorded duration of each
+* call multiplied by scale (default 0, answer immediately).
+*
+* Trace format, all integers LEB128 varints, signed ones zigzag encoded:
+*
+*     file    := "HALTRACE" version(1) record*
+*     record  := SESSION wallclock_s pid
+*              | API     id name_len name
+*              | CALL    id start_ns duration_ns ret(signed) arg_count arg*
+*     arg     := kind value(signed)                         for VALUE
+*              | kind tag bytes                             for strings and structures
+*              | kind tag (opt tag bytes)*                  for DHCP option lists
+*
+* tag is 0 for a NULL pointer, 1 for a string or option list output that was not captured
+* because the call failed, and length + 2 otherwise. Trailing zero bytes of structures are not stored.
+* API ids are only valid within their session, which lets sessions from builds with
+* different feature flags be appended to the same file.
+*/
+
+#ifndef __HAL_TRACE_H__
+#define __HAL_TRACE_H__
+
+#define HAL_TRACE_RECORD_ENV  "PLATFORM_HAL_RECORD"
+#define HAL_TRACE_REPLAY_ENV  "PLATFORM_HAL_REPLAY"
+#define HAL_TRACE_TIMING_ENV  "PLATFORM_HAL_REPLAY_TIMING"
+
+/**
+* @brief Start recording or replaying according to the environment.
+*
+* @return 0 when neither is requested or the hook was registered, -1 on error
+*/
+int hal_trace_init(void);
+
+/**
+* @brief Return non zero when calls are answered from a trace instead of the HAL.
+*/
+int hal_trace_replaying(void);
+
+#endif /* __HAL_TRACE_H__ */
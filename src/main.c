@@ -20,6 +20,19 @@
 #include <ut_log.h>
 #include <stdlib.h>
 #include "platform_hal.h"
+#include "hal_arena.h"
+#include "hal_daemon.h"
+#include "hal_footprint.h"
+#include "hal_log.h"
+#include "hal_race.h"
+#include "hal_soak.h"
+#ifdef HAL_INTERPOSE
+#include "hal_fault.h"
+#include "hal_trace.h"
+#ifdef HAL_HEAP
+#include "hal_heap.h"
+#endif
+#endif
 
 extern int MaxEthPort;
 extern char PartnerID[512] ;
@@ -35,6 +48,7 @@ extern char** InterfaceNames;
 extern int num_InterfaceNames;
 
 extern int register_hal_l1_tests( void );
+extern int run_hal_soak_tests( void );
 extern int get_MaxEthPort(void);
 extern int get_PartnerID(void);
 extern int get_FactoryCmVariant(void);
@@ -83,6 +97,7 @@ int init_platform_hal_init(void)
             UT_LOG("platform_hal_initThermal returned failure");
             UT_FAIL("platform_hal_initThermal initialization failed");
         }
+        free(thermalConfig);
     }
     else
     {
@@ -96,7 +111,64 @@ int init_platform_hal_init(void)
 int main(int argc, char** argv)
 {
     int registerReturn = 0;
+    int result = 0;
     int i = 0;
+#ifdef HAL_LOG_BACKEND
+    if (hal_log_init() != 0)
+    {
+        printf("Failed to start the log backend\n");
+        return 1;
+    }
+#endif
+    if (hal_footprint_init() != 0)
+    {
+        printf("Failed to set up the per test footprint\n");
+        return 1;
+    }
+    if (hal_arena_init() != 0)
+    {
+        printf("Failed to set up the per test arena\n");
+        return 1;
+    }
+    if (hal_soak_init(&argc, argv) != 0)
+    {
+        printf("Failed to set up the soak run\n");
+        return 1;
+    }
+    if (hal_race_init(&argc, argv) != 0)
+    {
+        printf("Failed to set up the race run\n");
+        return 1;
+    }
+    if (hal_daemon_init(&argc, argv) != 0)
+    {
+        printf("Failed to set up the daemon\n");
+        return 1;
+    }
+    if (hal_soak_enabled() + hal_race_enabled() + hal_daemon_enabled() > 1)
+    {
+        printf("Only one of %s, %s and %s can be given\n", HAL_SOAK_ARG, HAL_RACE_ARG, HAL_DAEMON_ARG);
+        return 1;
+    }
+#ifdef HAL_INTERPOSE
+    if (hal_fault_init() != 0)
+    {
+        printf("Failed to enable fault injection\n");
+        return 1;
+    }
+    if (hal_trace_init() != 0)
+    {
+        printf("Failed to enable HAL call recording or replay\n");
+        return 1;
+    }
+#ifdef HAL_HEAP
+    if (hal_heap_init() != 0)
+    {
+        printf("Failed to enable heap attribution\n");
+        return 1;
+    }
+#endif
+#endif
     if (get_MaxEthPort() == 0)
     {
         UT_LOG("Got the MaxEthPort value : %d", MaxEthPort);
@@ -176,20 +248,45 @@ int main(int argc, char** argv)
         printf("Failed to get InterfaceNames value\n");
     }
 
-    /* Register tests as required, then call the UT-main to support switches and triggering */
-    UT_init( argc, argv );
-    /* Check if tests are registered successfully */
-    registerReturn = register_hal_l1_tests();
-    if (registerReturn == 0)
+#ifdef HAL_LOG_BACKEND
+    hal_log_flush();
+#endif
+    if (hal_soak_enabled())
     {
-        printf("register_hal_l1_tests() returned success \n");
+        /* Soak runs loop over the L1 cases themselves, without the UT-main */
+        init_platform_hal_init();
+        result = (run_hal_soak_tests() == 0) ? 0 : 1;
+    }
+    else if (hal_race_enabled())
+    {
+        init_platform_hal_init();
+        result = (hal_race_run() == 0) ? 0 : 1;
+    }
+    else if (hal_daemon_enabled())
+    {
+        init_platform_hal_init();
+        result = (hal_daemon_run() == 0) ? 0 : 1;
     }
     else
     {
-        printf("register_hal_l1_tests() returned failure");
-        return 1;
+        /* Register tests as required, then call the UT-main to support switches and triggering */
+        UT_init( argc, argv );
+        /* Check if tests are registered successfully */
+        registerReturn = register_hal_l1_tests();
+        if (registerReturn == 0)
+        {
+            printf("register_hal_l1_tests() returned success \n");
+        }
+        else
+        {
+            printf("register_hal_l1_tests() returned failure");
+            return 1;
+        }
+        UT_run_tests();
     }
-    UT_run_tests();
+#ifdef HAL_LOG_BACKEND
+    hal_log_flush();
+#endif
 
     freeFactoryCmVariant();
     free(supportedCpus);
@@ -197,5 +294,5 @@ int main(int argc, char** argv)
     free(FanIndex);
     freeInterfaceNames();
 
-    return 0;
+    return result;
 }
\ No newline at end of file
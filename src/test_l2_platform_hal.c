@@ -0,0 +1,580 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+* @file test_l2_platform_hal.c
+* @page platform_hal Level 2 Tests
+*
+* ## Module's Role
+* This module includes Level 2 functional tests (Set/Get round trips).
+* Each test stores a value through a setter, reads it back through the matching getter and
+* restores the original value, so the tests can run against any vendor implementation.
+*
+* **Pre-Conditions:**  None @n
+* **Dependencies:** None @n
+*
+* Ref to API Definition specification documentation : [halSpec.md](../../../docs/halSpec.md)
+*/
+
+#include <ut.h>
+#include <ut_log.h>
+#include <stdlib.h>
+#include <string.h>
+#include "platform_hal.h"
+#include "hal_clock.h"
+#include "hal_fixture.h"
+#include "hal_log.h"
+
+extern int MaxEthPort;
+extern int *FanIndex;
+extern int num_FanIndex;
+
+static UT_test_suite_t * pSuite = NULL;
+
+/**
+* @brief Verify that the Telnet and SSH enable flags read back what was set.
+*
+* **Test Group ID:** 02 @n
+* **Test Case ID:** 001 @n
+* **Priority:** High @n@n
+*
+* **Pre-Conditions:** None @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Set Telnet enable to TRUE then FALSE, reading back after each set | Flag = TRUE, FALSE | Getter returns the value set | Should be successful |
+* | 02 | Set SSH enable to TRUE then FALSE, reading back after each set | Flag = TRUE, FALSE | Getter returns the value set | Should be successful |
+*/
+void test_l2_platform_hal_TelnetSSHEnable_RoundTrip(void)
+{
+    HAL_LOG_DEBUG("Entering test_l2_platform_hal_TelnetSSHEnable_RoundTrip...");
+    BOOLEAN origTelnet = FALSE;
+    BOOLEAN origSSH = FALSE;
+    BOOLEAN flag = FALSE;
+    BOOLEAN values[] = { TRUE, FALSE };
+    int i = 0;
+
+    UT_ASSERT_EQUAL(platform_hal_GetTelnetEnable(&origTelnet), RETURN_OK);
+    UT_ASSERT_EQUAL(platform_hal_GetSSHEnable(&origSSH), RETURN_OK);
+
+    for (i = 0; i < 2; i++)
+    {
+        HAL_LOG_DEBUG("Invoking platform_hal_SetTelnetEnable with Flag = %d.", values[i]);
+        UT_ASSERT_EQUAL(platform_hal_SetTelnetEnable(values[i]), RETURN_OK);
+        UT_ASSERT_EQUAL(platform_hal_GetTelnetEnable(&flag), RETURN_OK);
+        UT_LOG("platform_hal_GetTelnetEnable returns Flag = %d", flag);
+        UT_ASSERT_EQUAL(flag, values[i]);
+
+        HAL_LOG_DEBUG("Invoking platform_hal_SetSSHEnable with Flag = %d.", values[i]);
+        UT_ASSERT_EQUAL(platform_hal_SetSSHEnable(values[i]), RETURN_OK);
+        UT_ASSERT_EQUAL(platform_hal_GetSSHEnable(&flag), RETURN_OK);
+        UT_LOG("platform_hal_GetSSHEnable returns Flag = %d", flag);
+        UT_ASSERT_EQUAL(flag, values[i]);
+    }
+
+    platform_hal_SetTelnetEnable(origTelnet);
+    platform_hal_SetSSHEnable(origSSH);
+    HAL_LOG_DEBUG("Exiting test_l2_platform_hal_TelnetSSHEnable_RoundTrip...");
+}
+
+/**
+* @brief Verify that every SNMP mode accepted by platform_hal_SetSNMPEnable is returned by platform_hal_GetSNMPEnable.
+*
+* **Test Group ID:** 02 @n
+* **Test Case ID:** 002 @n
+* **Priority:** High @n@n
+*
+* **Pre-Conditions:** None @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Set each SNMP mode and read it back | pValue = rgWan, rgDualIp, rgLanIp | Getter returns the value set | Should be successful |
+* | 02 | Set an invalid SNMP mode and read back | pValue = invalidValue | RETURN_ERR, previous value unchanged | Should be rejected |
+*/
+void test_l2_platform_hal_SNMPEnable_RoundTrip(void)
+{
+    HAL_LOG_DEBUG("Entering test_l2_platform_hal_SNMPEnable_RoundTrip...");
+    CHAR values[][32] = { "rgWan", "rgDualIp", "rgLanIp" };
+    CHAR orig[32] = {"\0"};
+    CHAR pValue[32] = {"\0"};
+    CHAR invalid[32] = "invalidValue";
+    int i = 0;
+
+    UT_ASSERT_EQUAL(platform_hal_GetSNMPEnable(orig), RETURN_OK);
+
+    for (i = 0; i < 3; i++)
+    {
+        HAL_LOG_DEBUG("Invoking platform_hal_SetSNMPEnable with pValue = %s.", values[i]);
+        UT_ASSERT_EQUAL(platform_hal_SetSNMPEnable(values[i]), RETURN_OK);
+        UT_ASSERT_EQUAL(platform_hal_GetSNMPEnable(pValue), RETURN_OK);
+        UT_LOG("platform_hal_GetSNMPEnable returns pValue = %s", pValue);
+        UT_ASSERT_STRING_EQUAL(pValue, values[i]);
+    }
+
+    HAL_LOG_DEBUG("Invoking platform_hal_SetSNMPEnable with invalid pValue = %s.", invalid);
+    UT_ASSERT_EQUAL(platform_hal_SetSNMPEnable(invalid), RETURN_ERR);
+    UT_ASSERT_EQUAL(platform_hal_GetSNMPEnable(pValue), RETURN_OK);
+    UT_ASSERT_STRING_EQUAL(pValue, values[2]);
+
+    platform_hal_SetSNMPEnable(orig);
+    HAL_LOG_DEBUG("Exiting test_l2_platform_hal_SNMPEnable_RoundTrip...");
+}
+
+/**
+* @brief Verify that platform_hal_GetWebUITimeout returns the value stored by platform_hal_SetWebUITimeout.
+*
+* **Test Group ID:** 02 @n
+* **Test Case ID:** 003 @n
+* **Priority:** High @n@n
+*
+* **Pre-Conditions:** None @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Set the boundary timeouts and read them back | value = 30, 86400 | Getter returns the value set | Should be successful |
+* | 02 | Set an out of range timeout and read back | value = 86401 | RETURN_ERR, previous value unchanged | Should be rejected |
+*/
+void test_l2_platform_hal_WebUITimeout_RoundTrip(void)
+{
+    HAL_LOG_DEBUG("Entering test_l2_platform_hal_WebUITimeout_RoundTrip...");
+    ULONG values[] = { 30, 86400 };
+    ULONG orig = 0;
+    ULONG value = 0;
+    int i = 0;
+
+    UT_ASSERT_EQUAL(platform_hal_GetWebUITimeout(&orig), RETURN_OK);
+
+    for (i = 0; i < 2; i++)
+    {
+        HAL_LOG_DEBUG("Invoking platform_hal_SetWebUITimeout with value = %lu.", values[i]);
+        UT_ASSERT_EQUAL(platform_hal_SetWebUITimeout(values[i]), RETURN_OK);
+        UT_ASSERT_EQUAL(platform_hal_GetWebUITimeout(&value), RETURN_OK);
+        UT_LOG("platform_hal_GetWebUITimeout returns value = %lu", value);
+        UT_ASSERT_EQUAL(value, values[i]);
+    }
+
+    HAL_LOG_DEBUG("Invoking platform_hal_SetWebUITimeout with invalid value = 86401.");
+    UT_ASSERT_EQUAL(platform_hal_SetWebUITimeout(86401), RETURN_ERR);
+    UT_ASSERT_EQUAL(platform_hal_GetWebUITimeout(&value), RETURN_OK);
+    UT_ASSERT_EQUAL(value, values[1]);
+
+    platform_hal_SetWebUITimeout(orig);
+    HAL_LOG_DEBUG("Exiting test_l2_platform_hal_WebUITimeout_RoundTrip...");
+}
+
+/**
+* @brief Verify that platform_hal_getFactoryCmVariant returns the variant stored by platform_hal_setFactoryCmVariant.
+*
+* **Test Group ID:** 02 @n
+* **Test Case ID:** 004 @n
+* **Priority:** High @n@n
+*
+* **Pre-Conditions:** None @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Set each CM variant and read it back | pValue = unknown, pc20, pc20genband, pc15sip, pc15mgcp | Getter returns the value set | Should be successful |
+*/
+void test_l2_platform_hal_FactoryCmVariant_RoundTrip(void)
+{
+    HAL_LOG_DEBUG("Entering test_l2_platform_hal_FactoryCmVariant_RoundTrip...");
+    CHAR values[][32] = { "unknown", "pc20", "pc20genband", "pc15sip", "pc15mgcp" };
+    CHAR orig[512] = {"\0"};
+    CHAR pValue[512] = {"\0"};
+    int i = 0;
+
+    UT_ASSERT_EQUAL(platform_hal_getFactoryCmVariant(orig), RETURN_OK);
+
+    for (i = 0; i < 5; i++)
+    {
+        HAL_LOG_DEBUG("Invoking platform_hal_setFactoryCmVariant with pValue = %s.", values[i]);
+        UT_ASSERT_EQUAL(platform_hal_setFactoryCmVariant(values[i]), RETURN_OK);
+        UT_ASSERT_EQUAL(platform_hal_getFactoryCmVariant(pValue), RETURN_OK);
+        UT_LOG("platform_hal_getFactoryCmVariant returns pValue = %s", pValue);
+        UT_ASSERT_STRING_EQUAL(pValue, values[i]);
+    }
+
+    platform_hal_setFactoryCmVariant(orig);
+    HAL_LOG_DEBUG("Exiting test_l2_platform_hal_FactoryCmVariant_RoundTrip...");
+}
+
+/**
+* @brief Verify that platform_hal_getLed returns the LED parameters stored by platform_hal_setLed.
+*
+* **Test Group ID:** 02 @n
+* **Test Case ID:** 005 @n
+* **Priority:** High @n@n
+*
+* **Pre-Conditions:** None @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Set every colour with a blinking state and read it back | LedColor = 0-6, State = 1, Interval = 5 | Getter returns the values set | Should be successful |
+*/
+void test_l2_platform_hal_Led_RoundTrip(void)
+{
+    HAL_LOG_DEBUG("Entering test_l2_platform_hal_Led_RoundTrip...");
+    LEDMGMT_PARAMS orig;
+    LEDMGMT_PARAMS params;
+    int ledColor = 0;
+
+    memset(&orig, 0, sizeof(orig));
+    UT_ASSERT_EQUAL(platform_hal_getLed(&orig), RETURN_OK);
+
+    for (ledColor = 0; ledColor <= 6; ledColor++)
+    {
+        params.LedColor = ledColor;
+        params.State = 1;
+        params.Interval = 5;
+        HAL_LOG_DEBUG("Invoking platform_hal_setLed with LedColor: %d, State: %d, Interval: %d", params.LedColor, params.State, params.Interval);
+        UT_ASSERT_EQUAL(platform_hal_setLed(&params), RETURN_OK);
+
+        memset(&params, 0, sizeof(params));
+        UT_ASSERT_EQUAL(platform_hal_getLed(&params), RETURN_OK);
+        UT_LOG("platform_hal_getLed returns LedColor: %d, State: %d, Interval: %d", params.LedColor, params.State, params.Interval);
+        UT_ASSERT_EQUAL((INT)params.LedColor, ledColor);
+        UT_ASSERT_EQUAL(params.State, 1);
+        UT_ASSERT_EQUAL(params.Interval, 5);
+    }
+
+    platform_hal_setLed(&orig);
+    HAL_LOG_DEBUG("Exiting test_l2_platform_hal_Led_RoundTrip...");
+}
+
+/**
+* @brief Verify that MACsec enable and operational status follow SetMACsecEnable, StartMACsec and StopMACsec.
+*
+* **Test Group ID:** 02 @n
+* **Test Case ID:** 006 @n
+* **Priority:** High @n@n
+*
+* **Pre-Conditions:** MaxEthPort should be configured in platform_config @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Enable MACsec on every port and read the flag back | ethPort = 0..MaxEthPort-1, Flag = 1 | GetMACsecEnable returns 1 | Should be successful |
+* | 02 | Start MACsec and read the operational status | timeoutSec = 0 | GetMACsecOperationalStatus returns 1 | Should be successful |
+* | 03 | Stop MACsec and read the operational status | ethPort = 0..MaxEthPort-1 | GetMACsecOperationalStatus returns 0 | Should be successful |
+*/
+void test_l2_platform_hal_MACsec_RoundTrip(void)
+{
+    HAL_LOG_DEBUG("Entering test_l2_platform_hal_MACsec_RoundTrip...");
+    BOOLEAN orig = FALSE;
+    BOOLEAN flag = FALSE;
+    INT ethPort = 0;
+
+    for (ethPort = 0; ethPort < MaxEthPort; ethPort++)
+    {
+        UT_ASSERT_EQUAL(platform_hal_GetMACsecEnable(ethPort, &orig), RETURN_OK);
+
+        HAL_LOG_DEBUG("Invoking platform_hal_SetMACsecEnable with ethPort = %d, Flag = 1", ethPort);
+        UT_ASSERT_EQUAL(platform_hal_SetMACsecEnable(ethPort, TRUE), RETURN_OK);
+        UT_ASSERT_EQUAL(platform_hal_GetMACsecEnable(ethPort, &flag), RETURN_OK);
+        UT_LOG("platform_hal_GetMACsecEnable returns Flag = %d", flag);
+        UT_ASSERT_EQUAL(flag, TRUE);
+
+        HAL_LOG_DEBUG("Invoking platform_hal_StartMACsec with ethPort = %d, timeoutSec = 0", ethPort);
+        UT_ASSERT_EQUAL(platform_hal_StartMACsec(ethPort, 0), RETURN_OK);
+        UT_ASSERT_EQUAL(platform_hal_GetMACsecOperationalStatus(ethPort, &flag), RETURN_OK);
+        UT_LOG("platform_hal_GetMACsecOperationalStatus returns Flag = %d", flag);
+        UT_ASSERT_EQUAL(flag, TRUE);
+
+        HAL_LOG_DEBUG("Invoking platform_hal_StopMACsec with ethPort = %d", ethPort);
+        UT_ASSERT_EQUAL(platform_hal_StopMACsec(ethPort), RETURN_OK);
+        UT_ASSERT_EQUAL(platform_hal_GetMACsecOperationalStatus(ethPort, &flag), RETURN_OK);
+        UT_LOG("platform_hal_GetMACsecOperationalStatus returns Flag = %d", flag);
+        UT_ASSERT_EQUAL(flag, FALSE);
+
+        platform_hal_SetMACsecEnable(ethPort, orig);
+    }
+    HAL_LOG_DEBUG("Exiting test_l2_platform_hal_MACsec_RoundTrip...");
+}
+
+#ifdef FEATURE_RDKB_THERMAL_MANAGER
+/* getFanSpeed reports RPM, so the FAN_SPEED to restore is the one that reports the same speed, or the closest */
+static void restore_fan_speed(UINT fanIndex, UINT speed)
+{
+    FAN_ERR pErrReason = FAN_ERR_NONE;
+    FAN_SPEED best = FAN_SPEED_MAX;
+    UINT bestDistance = (UINT)-1;
+    int fanSpeed;
+
+    for (fanSpeed = FAN_SPEED_MAX; fanSpeed >= FAN_SPEED_OFF; fanSpeed--)
+    {
+        UINT reported;
+        UINT distance;
+
+        if (platform_hal_setFanSpeed(fanIndex, (FAN_SPEED)fanSpeed, &pErrReason) != RETURN_OK)
+        {
+            continue;
+        }
+        reported = platform_hal_getFanSpeed(fanIndex);
+        if (reported == speed)
+        {
+            return;
+        }
+        distance = (reported > speed) ? reported - speed : speed - reported;
+        if (distance < bestDistance)
+        {
+            best = (FAN_SPEED)fanSpeed;
+            bestDistance = distance;
+        }
+    }
+    platform_hal_setFanSpeed(fanIndex, best, &pErrReason);
+}
+#endif
+
+/**
+* @brief Verify that a fan under max override reports full speed and refuses platform_hal_setFanSpeed.
+*
+* **Test Group ID:** 02 @n
+* **Test Case ID:** 007 @n
+* **Priority:** High @n@n
+*
+* **Pre-Conditions:** FanIndex should be configured in platform_config @n
+* **Dependencies:** None @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Enable max override and read the fan status | bOverrideFlag = 1 | getFanStatus returns 1 | Should be successful |
+* | 02 | Set a slower speed while override is active | fanSpeed = FAN_SPEED_SLOW | RETURN_ERR, pErrReason = FAN_ERR_MAX_OVERRIDE_SET | Should be rejected |
+* | 03 | Clear max override and set the speed again | bOverrideFlag = 0 | RETURN_OK, pErrReason = FAN_ERR_NONE | Should be successful |
+* | 04 | Restore the speed read before step 01 | fanSpeed = the one reporting the original getFanSpeed | getFanStatus and getFanSpeed as before | Should be successful |
+*
+* The HAL cannot report whether max override was set, so the fan is left with override cleared,
+* running at the original speed.
+*/
+void test_l2_platform_hal_FanMaxOverride_RoundTrip(void)
+{
+    HAL_LOG_DEBUG("Entering test_l2_platform_hal_FanMaxOverride_RoundTrip...");
+    int i = 0;
+
+    for (i = 0; i < num_FanIndex; i++)
+    {
+        BOOLEAN origStatus = platform_hal_getFanStatus(FanIndex[i]);
+        UINT origSpeed = platform_hal_getFanSpeed(FanIndex[i]);
+
+        UT_LOG("Fan %d status %d, speed %u before the test", FanIndex[i], origStatus, origSpeed);
+        HAL_LOG_DEBUG("Invoking platform_hal_setFanMaxOverride with bOverrideFlag = 1, fanIndex = %d", FanIndex[i]);
+        UT_ASSERT_EQUAL(platform_hal_setFanMaxOverride(TRUE, FanIndex[i]), RETURN_OK);
+        UT_ASSERT_EQUAL(platform_hal_getFanStatus(FanIndex[i]), TRUE);
+#ifdef FEATURE_RDKB_THERMAL_MANAGER
+        FAN_ERR pErrReason = FAN_ERR_NONE;
+
+        HAL_LOG_DEBUG("Invoking platform_hal_setFanSpeed with fanIndex = %d, fanSpeed = FAN_SPEED_SLOW while override is set", FanIndex[i]);
+        UT_ASSERT_EQUAL(platform_hal_setFanSpeed(FanIndex[i], FAN_SPEED_SLOW, &pErrReason), RETURN_ERR);
+        UT_LOG("pErrReason : %d", pErrReason);
+        UT_ASSERT_EQUAL(pErrReason, FAN_ERR_MAX_OVERRIDE_SET);
+#endif
+        HAL_LOG_DEBUG("Invoking platform_hal_setFanMaxOverride with bOverrideFlag = 0, fanIndex = %d", FanIndex[i]);
+        UT_ASSERT_EQUAL(platform_hal_setFanMaxOverride(FALSE, FanIndex[i]), RETURN_OK);
+#ifdef FEATURE_RDKB_THERMAL_MANAGER
+        UT_ASSERT_EQUAL(platform_hal_setFanSpeed(FanIndex[i], FAN_SPEED_SLOW, &pErrReason), RETURN_OK);
+        UT_ASSERT_EQUAL(pErrReason, FAN_ERR_NONE);
+
+        HAL_LOG_DEBUG("Restoring fan %d to the FAN_SPEED reporting speed %u", FanIndex[i], origSpeed);
+        restore_fan_speed(FanIndex[i], origSpeed);
+        UT_ASSERT_EQUAL(platform_hal_getFanSpeed(FanIndex[i]), origSpeed);
+        UT_ASSERT_EQUAL(platform_hal_getFanStatus(FanIndex[i]), origStatus);
+#endif
+    }
+    HAL_LOG_DEBUG("Exiting test_l2_platform_hal_FanMaxOverride_RoundTrip...");
+}
+
+/**
+* @brief Verify that an image left unvalidated when SetDeviceCodeImageTimeout expires is rolled back.
+*
+* Needs the virtual clock of the Linux skeleton to reach the expiry without waiting, and is
+* skipped against a vendor HAL.
+*
+* **Test Group ID:** 02 @n
+* **Test Case ID:** 008 @n
+* **Priority:** Medium @n@n
+*
+* **Pre-Conditions:** None @n
+* **Dependencies:** Virtual clock of the Linux skeleton @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Mark the image invalid, arm the timeout, validate it half way and pass the expiry | seconds = 60 | Active bank unchanged and Confirmed | Should be successful |
+* | 02 | Mark the image invalid, arm the timeout and skip to the expiry | seconds = 60 | Active and inactive banks swapped | Should be successful |
+* | 03 | Repeat with a one second timeout to return to the original image | seconds = 1 | Original active bank restored | Should be successful |
+*/
+void test_l2_platform_hal_ImageTimeout_Expiry(void)
+{
+    HAL_LOG_DEBUG("Entering test_l2_platform_hal_ImageTimeout_Expiry...");
+    FW_BANK_INFO active;
+    FW_BANK_INFO inactive;
+    FW_BANK_INFO bank;
+    int64_t moved = 0;
+
+    if (!hal_clock_available())
+    {
+        UT_LOG("No virtual clock in the HAL under test, skipping");
+        return;
+    }
+    UT_ASSERT_EQUAL(platform_hal_GetFirmwareBankInfo(ACTIVE_BANK, &active), RETURN_OK);
+    UT_ASSERT_EQUAL(platform_hal_GetFirmwareBankInfo(INACTIVE_BANK, &inactive), RETURN_OK);
+    UT_LOG("Active bank %s (%s), inactive bank %s (%s)", active.fw_name, active.fw_state, inactive.fw_name, inactive.fw_state);
+
+    HAL_LOG_DEBUG("Invoking platform_hal_SetDeviceCodeImageTimeout with seconds = 60 and validating after 30 seconds");
+    UT_ASSERT_EQUAL(platform_hal_SetDeviceCodeImageValid(FALSE), RETURN_OK);
+    UT_ASSERT_EQUAL(platform_hal_SetDeviceCodeImageTimeout(60), RETURN_OK);
+    hal_clock_advance_ms(30000);
+    UT_ASSERT_EQUAL(platform_hal_SetDeviceCodeImageValid(TRUE), RETURN_OK);
+    hal_clock_advance_ms(60000);
+    UT_ASSERT_EQUAL(platform_hal_GetFirmwareBankInfo(ACTIVE_BANK, &bank), RETURN_OK);
+    UT_LOG("Active bank %s (%s)", bank.fw_name, bank.fw_state);
+    UT_ASSERT_STRING_EQUAL(bank.fw_name, active.fw_name);
+    UT_ASSERT_STRING_EQUAL(bank.fw_state, "Confirmed");
+
+    HAL_LOG_DEBUG("Invoking platform_hal_SetDeviceCodeImageTimeout with seconds = 60 and skipping to the expiry");
+    UT_ASSERT_EQUAL(platform_hal_SetDeviceCodeImageValid(FALSE), RETURN_OK);
+    UT_ASSERT_EQUAL(platform_hal_SetDeviceCodeImageTimeout(60), RETURN_OK);
+    moved = hal_clock_skip();
+    UT_LOG("Virtual clock moved %lld ms", (long long)moved);
+    UT_ASSERT_TRUE(moved > 0 && moved <= 60000);
+    UT_ASSERT_EQUAL(platform_hal_GetFirmwareBankInfo(ACTIVE_BANK, &bank), RETURN_OK);
+    UT_LOG("Active bank %s (%s)", bank.fw_name, bank.fw_state);
+    UT_ASSERT_STRING_EQUAL(bank.fw_name, inactive.fw_name);
+    UT_ASSERT_STRING_EQUAL(bank.fw_state, "Confirmed");
+    UT_ASSERT_EQUAL(platform_hal_GetFirmwareBankInfo(INACTIVE_BANK, &bank), RETURN_OK);
+    UT_ASSERT_STRING_EQUAL(bank.fw_name, active.fw_name);
+
+    HAL_LOG_DEBUG("Invoking platform_hal_SetDeviceCodeImageTimeout with seconds = 1 to roll back to %s", active.fw_name);
+    UT_ASSERT_EQUAL(platform_hal_SetDeviceCodeImageValid(FALSE), RETURN_OK);
+    UT_ASSERT_EQUAL(platform_hal_SetDeviceCodeImageTimeout(1), RETURN_OK);
+    hal_clock_skip();
+    UT_ASSERT_EQUAL(platform_hal_GetFirmwareBankInfo(ACTIVE_BANK, &bank), RETURN_OK);
+    UT_ASSERT_STRING_EQUAL(bank.fw_name, active.fw_name);
+
+    platform_hal_SetDeviceCodeImageTimeout(0);
+    platform_hal_SetDeviceCodeImageValid(TRUE);
+    HAL_LOG_DEBUG("Exiting test_l2_platform_hal_ImageTimeout_Expiry...");
+}
+
+/**
+* @brief Verify that MACsec started with a short timeout becomes operational once authentication completes.
+*
+* Needs the virtual clock of the Linux skeleton to reach the end of authentication without
+* waiting, and is skipped against a vendor HAL. It is also skipped when authentication
+* completes within the timeout ("auth_ms" of the skeleton set to a second or less), since
+* nothing is then left pending.
+*
+* **Test Group ID:** 02 @n
+* **Test Case ID:** 009 @n
+* **Priority:** Medium @n@n
+*
+* **Pre-Conditions:** None @n
+* **Dependencies:** Virtual clock of the Linux skeleton @n
+* **User Interaction:** If user chose to run the test in interactive mode, then the test case has to be selected via console. @n
+*
+* **Test Procedure:** @n
+* | Variation / Step | Description | Test Data | Expected Result | Notes |
+* | :----: | --------- | ---------- |-------------- | ----- |
+* | 01 | Enable and start MACsec with a one second timeout, skip past the pending authentication | ethPort = 0, timeoutSec = 1 | GetMACsecOperationalStatus returns 0, then 1 | Should be successful |
+* | 02 | Advance the clock by an hour | 3600000 ms | GetMACsecOperationalStatus still returns 1 | Should be successful |
+*/
+void test_l2_platform_hal_MACsec_Authentication(void)
+{
+    HAL_LOG_DEBUG("Entering test_l2_platform_hal_MACsec_Authentication...");
+    BOOLEAN orig = FALSE;
+    BOOLEAN flag = FALSE;
+
+    if (!hal_clock_available())
+    {
+        UT_LOG("No virtual clock in the HAL under test, skipping");
+        return;
+    }
+    UT_ASSERT_EQUAL(platform_hal_GetMACsecEnable(0, &orig), RETURN_OK);
+    UT_ASSERT_EQUAL(platform_hal_SetMACsecEnable(0, TRUE), RETURN_OK);
+
+    HAL_LOG_DEBUG("Invoking platform_hal_StartMACsec with ethPort = 0, timeoutSec = 1");
+    UT_ASSERT_EQUAL(platform_hal_StartMACsec(0, 1), RETURN_OK);
+    UT_ASSERT_EQUAL(platform_hal_GetMACsecOperationalStatus(0, &flag), RETURN_OK);
+    UT_LOG("platform_hal_GetMACsecOperationalStatus returns Flag = %d on return", flag);
+    if (flag == TRUE)
+    {
+        UT_LOG("Authentication completed within the timeout, nothing pending to skip past, skipping");
+        platform_hal_StopMACsec(0);
+        platform_hal_SetMACsecEnable(0, orig);
+        return;
+    }
+    UT_LOG("Virtual clock moved %lld ms", (long long)hal_clock_skip());
+    UT_ASSERT_EQUAL(platform_hal_GetMACsecOperationalStatus(0, &flag), RETURN_OK);
+    UT_LOG("platform_hal_GetMACsecOperationalStatus returns Flag = %d", flag);
+    UT_ASSERT_EQUAL(flag, TRUE);
+
+    hal_clock_advance_ms(3600000);
+    UT_ASSERT_EQUAL(platform_hal_GetMACsecOperationalStatus(0, &flag), RETURN_OK);
+    UT_LOG("platform_hal_GetMACsecOperationalStatus returns Flag = %d after an hour", flag);
+    UT_ASSERT_EQUAL(flag, TRUE);
+
+    platform_hal_StopMACsec(0);
+    platform_hal_SetMACsecEnable(0, orig);
+    HAL_LOG_DEBUG("Exiting test_l2_platform_hal_MACsec_Authentication...");
+}
+
+/**
+* @brief Register the main tests for this module
+*
+* @return int - 0 on success, otherwise failure
+*/
+int test_platform_hal_l2_register(void)
+{
+    // Create the test suite
+    pSuite = UT_add_suite("[L2 platform_hal]", NULL, NULL);
+    if (pSuite == NULL)
+    {
+        return -1;
+    }
+    // List of test function names and strings
+    UT_add_test( pSuite, "l2_platform_hal_TelnetSSHEnable_RoundTrip", test_l2_platform_hal_TelnetSSHEnable_RoundTrip);
+    UT_add_test( pSuite, "l2_platform_hal_SNMPEnable_RoundTrip", test_l2_platform_hal_SNMPEnable_RoundTrip);
+    UT_add_test( pSuite, "l2_platform_hal_WebUITimeout_RoundTrip", test_l2_platform_hal_WebUITimeout_RoundTrip);
+    UT_add_test( pSuite, "l2_platform_hal_FactoryCmVariant_RoundTrip", test_l2_platform_hal_FactoryCmVariant_RoundTrip);
+    UT_add_test( pSuite, "l2_platform_hal_Led_RoundTrip", test_l2_platform_hal_Led_RoundTrip);
+    UT_add_test( pSuite, "l2_platform_hal_MACsec_RoundTrip", test_l2_platform_hal_MACsec_RoundTrip);
+    UT_add_test( pSuite, "l2_platform_hal_FanMaxOverride_RoundTrip", test_l2_platform_hal_FanMaxOverride_RoundTrip);
+    UT_add_test( pSuite, "l2_platform_hal_ImageTimeout_Expiry", test_l2_platform_hal_ImageTimeout_Expiry);
+    UT_add_test( pSuite, "l2_platform_hal_MACsec_Authentication", test_l2_platform_hal_MACsec_Authentication);
+
+    return 0;
+}
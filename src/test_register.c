@@ -19,11 +19,23 @@
 /* L1 Testing Functions */
 extern int test_platform_hal_l1_register(void);
 
+/* L2 Testing Functions */
+extern int test_platform_hal_l2_register(void);
+
+/* Soak Testing Functions */
+extern int test_platform_hal_l1_soak(void);
+
 int register_hal_l1_tests( void )
 {
     int registerFailed=0;
 
     registerFailed |= test_platform_hal_l1_register();
+    registerFailed |= test_platform_hal_l2_register();
 
     return registerFailed;
 }
+
+int run_hal_soak_tests( void )
+{
+    return test_platform_hal_l1_soak();
+}
@@ -0,0 +1,231 @@
+/*
+* If not stated otherwise in this file or this component's LICENSE file the
+* following copyright and licenses apply:*
+* Copyright 2023 RDK Management
+*
+* Licensed under the Apache License, Version 2.0 (the "License");
+* you may not use this file except in compliance with the License.
+* You may obtain a copy of the License at
+*
+* http://www.apache.org/licenses/LICENSE-2.0
+*
+* Unless required by applicable law or agreed to in writing, software
+* distributed under the License is distributed on an "AS IS" BASIS,
+* WITHOUT WARRANTIES OR CONDITIONS OF ANY KIND, either express or implied.
+* See the License for the specific language governing permissions and
+* limitations under the License.
+*/
+
+/**
+* @file hal_log_decode.c
+* @brief Host side decoder for the binary logs of LOG=binary builds.
+*
+* Usage: hal_log_decode [-j] <file>
+*
+* Prints every message of the log as text, or with -j as one JSON object per line. The call
+* site table at the start of the log supplies the file, line and format of each message ID, so
+* the decoder does not need the binary that wrote the log. The layout is described in
+* src/hal_log_format.h.
+*/
+
+#include <fcntl.h>
+#include <stdint.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <time.h>
+#include <unistd.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include "hal_log_format.h"
+
+#define MESSAGE_MAX  (4096)
+
+typedef struct
+{
+    uint32_t line;
+    char *file;
+    char *format;
+} site_t;
+
+static char *copy_string(const uint8_t *data, uint32_t length)
+{
+    char *string = (char *)malloc((size_t)length + 1);
+
+    if (string != NULL)
+    {
+        memcpy(string, data, length);
+        string[length] = '\0';
+    }
+    return string;
+}
+
+/* Reads the call site table, returning NULL if it is truncated */
+static site_t *read_sites(const uint8_t *data, size_t size, const hal_log_file_header_t *header)
+{
+    size_t offset = sizeof(*header);
+    site_t *sites = (site_t *)calloc((size_t)header->sites + 1, sizeof(site_t));
+    uint32_t i;
+
+    for (i = 0; sites != NULL && i < header->sites; i++)
+    {
+        uint32_t lengths[3];
+
+        if (offset + sizeof(lengths) > size)
+        {
+            return NULL;
+        }
+        memcpy(lengths, data + offset, sizeof(lengths));
+        offset += sizeof(lengths);
+        if ((uint64_t)offset + lengths[1] + lengths[2] > size)
+        {
+            return NULL;
+        }
+        sites[i].line = lengths[0];
+        sites[i].file = copy_string(data + offset, lengths[1]);
+        sites[i].format = copy_string(data + offset + lengths[1], lengths[2]);
+        offset += (size_t)lengths[1] + lengths[2];
+        if (sites[i].file == NULL || sites[i].format == NULL)
+        {
+            return NULL;
+        }
+    }
+    return sites;
+}
+
+static void print_json_string(const char *text)
+{
+    putchar('"');
+    for (; *text != '\0'; text++)
+    {
+        unsigned char c = (unsigned char)*text;
+
+        if (c == '"' || c == '\\')
+        {
+            printf("\\%c", c);
+        }
+        else if (c == '\n')
+        {
+            fputs("\\n", stdout);
+        }
+        else if (c < 0x20)
+        {
+            printf("\\u%04x", c);
+        }
+        else
+        {
+            putchar(c);
+        }
+    }
+    putchar('"');
+}
+
+static void print_record(const hal_log_record_t *record, const site_t *site, int json)
+{
+    char message[MESSAGE_MAX];
+    size_t length;
+
+    hal_log_render(message, sizeof(message), site->format, (const uint8_t *)(record + 1), record->size - sizeof(*record));
+    length = strlen(message);
+    if (length > 0 && message[length - 1] == '\n')
+    {
+        message[length - 1] = '\0';
+    }
+    if (json)
+    {
+        printf("{\"time_ns\":%llu,\"id\":%u,\"file\":", (unsigned long long)record->timeNs, record->id);
+        print_json_string(site->file);
+        printf(",\"line\":%u,\"message\":", site->line);
+        print_json_string(message);
+        printf("}\n");
+    }
+    else
+    {
+        time_t seconds = (time_t)(record->timeNs / 1000000000ULL);
+        struct tm local;
+        char stamp[32];
+
+        localtime_r(&seconds, &local);
+        strftime(stamp, sizeof(stamp), "%Y-%m-%d %H:%M:%S", &local);
+        printf("%s.%06llu [UT] %s:%u %s\n", stamp, (unsigned long long)(record->timeNs % 1000000000ULL) / 1000,
+               site->file, site->line, message);
+    }
+}
+
+int main(int argc, char **argv)
+{
+    const hal_log_file_header_t *header;
+    const uint8_t *data;
+    unsigned long long messages = 0;
+    unsigned long long torn = 0;
+    uint64_t chunk;
+    uint64_t end;
+    site_t *sites;
+    struct stat info;
+    int json = (argc == 3 && strcmp(argv[1], "-j") == 0);
+    int fd;
+
+    if (argc != 2 + json)
+    {
+        fprintf(stderr, "Usage: %s [-j] <file>\n", argv[0]);
+        return 2;
+    }
+    fd = open(argv[argc - 1], O_RDONLY);
+    if (fd < 0 || fstat(fd, &info) != 0 || (size_t)info.st_size < sizeof(*header) ||
+        (data = (const uint8_t *)mmap(NULL, (size_t)info.st_size, PROT_READ, MAP_PRIVATE, fd, 0)) == MAP_FAILED)
+    {
+        fprintf(stderr, "Cannot read %s\n", argv[argc - 1]);
+        return 1;
+    }
+    header = (const hal_log_file_header_t *)data;
+    if (memcmp(header->magic, HAL_LOG_MAGIC, sizeof(HAL_LOG_MAGIC)) != 0 || header->version != HAL_LOG_VERSION)
+    {
+        fprintf(stderr, "%s is not a binary HAL log\n", argv[argc - 1]);
+        return 1;
+    }
+    if (header->endian != HAL_LOG_ENDIAN)
+    {
+        fprintf(stderr, "%s was written with the other byte order\n", argv[argc - 1]);
+        return 1;
+    }
+    sites = read_sites(data, (size_t)info.st_size, header);
+    if (sites == NULL || header->chunk < sizeof(hal_log_record_t))
+    {
+        fprintf(stderr, "%s is truncated or corrupt\n", argv[argc - 1]);
+        return 1;
+    }
+    end = (uint64_t)info.st_size;
+    if (header->chunks != 0 && header->dataOffset + header->chunks * header->chunk < end)
+    {
+        end = header->dataOffset + header->chunks * header->chunk;
+    }
+    for (chunk = header->dataOffset; chunk < end; chunk += header->chunk)
+    {
+        uint64_t limit = (chunk + header->chunk < end) ? chunk + header->chunk : end;
+        uint64_t offset = chunk;
+
+        while (offset + sizeof(hal_log_record_t) <= limit)
+        {
+            hal_log_record_t record;
+
+            memcpy(&record, data + offset, sizeof(record));
+            if (record.size == 0)
+            {
+                offset += 8;    /* Unused end of a chunk, or a record a crash left unwritten */
+                continue;
+            }
+            if (record.size < sizeof(record) || (record.size & 7) != 0 || offset + record.size > limit || record.id >= header->sites)
+            {
+                torn++;
+                offset += 8;
+                continue;
+            }
+            print_record((const hal_log_record_t *)(data + offset), &sites[record.id], json);
+            messages++;
+            offset += record.size;
+        }
+    }
+    fprintf(stderr, "%llu messages from %u call sites, %llu dropped by the writer, %llu torn records%s\n", messages,
+            header->sites, (unsigned long long)header->dropped, torn, (header->chunks == 0) ? ", writer did not exit cleanly" : "");
+    return 0;
+}